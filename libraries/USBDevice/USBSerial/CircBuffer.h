@@ -19,6 +19,11 @@
 #ifndef CIRCBUFFER_H
 #define CIRCBUFFER_H
 
+#include "critical.h"
+
+// queue() runs in the USB interrupt and may move read when the buffer is
+// full, so both ends update the indexes inside a critical section
+
 template <class T>
 class CircBuffer {
 public:
@@ -42,12 +47,14 @@ public:
     };
 
     void queue(T k) {
+        core_util_critical_section_enter();
         if (isFull()) {
             read++;
             read %= size;
         }
         buf[write++] = k;
         write %= size;
+        core_util_critical_section_exit();
     }
 
     uint16_t available() {
@@ -55,11 +62,13 @@ public:
     };
 
     bool dequeue(T * c) {
+        core_util_critical_section_enter();
         bool empty = isEmpty();
         if (!empty) {
             *c = buf[read++];
             read %= size;
         }
+        core_util_critical_section_exit();
         return(!empty);
     };
 
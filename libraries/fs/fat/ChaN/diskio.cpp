@@ -8,6 +8,7 @@
 #include "diskio.h"
 
 #include "mbed_debug.h"
+#include "mbed_profile.h"
 #include "FATFileSystem.h"
 
 using namespace mbed;
@@ -35,6 +36,7 @@ DRESULT disk_read (
     BYTE count        /* Number of sectors to read (1..255) */
 )
 {
+    MBED_PROFILE_SCOPE(disk_read);
     debug_if(FFS_DBG, "disk_read(sector %d, count %d) on drv [%d]\n", sector, count, drv);
     for(DWORD s=sector; s<sector+count; s++) {
         debug_if(FFS_DBG, " disk_read(sector %d)\n", s);
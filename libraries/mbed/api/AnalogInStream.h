@@ -0,0 +1,129 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_ANALOGINSTREAM_H
+#define MBED_ANALOGINSTREAM_H
+
+#include "platform.h"
+
+#if DEVICE_ANALOGIN_STREAM
+
+#include "analogin_api.h"
+#include "Callback.h"
+
+namespace mbed {
+
+/** Continuous, timer triggered sampling of one or more analog inputs
+ *
+ * Conversions are paced by a hardware timer and written into a buffer
+ * that is used as two halves: while one half is being filled, the other
+ * is handed to the callback, which runs in interrupt context and must be
+ * done with it before the next half completes. Samples can be stored as
+ * q15_t or float so the halves can be passed straight to CMSIS-DSP.
+ *
+ * With more than one input the samples are interleaved, one frame of
+ * one sample per input at a time. All inputs must be on the same ADC,
+ * and only one AnalogInStream can be running at a time.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * AnalogInStream mic(p20);
+ * float samples[512];
+ * volatile float level;
+ *
+ * void block(void *data, int count) {
+ *     float *s = (float*)data, sum = 0;
+ *     for (int i = 0; i < count; i++)
+ *         sum += s[i];
+ *     level = sum / count;
+ * }
+ *
+ * int main() {
+ *     mic.start(50000, samples, 512, block, AnalogInFormatF32);
+ *     while (1) {
+ *         printf("%f\n", level);
+ *         wait(0.5);
+ *     }
+ * }
+ * @endcode
+ */
+class AnalogInStream {
+
+public:
+    /** Callback type, called with the first sample of the completed half
+     *  and the number of samples in it
+     */
+    typedef Callback<void(void*, int)> block_callback_t;
+
+    /** Create an AnalogInStream, sampling up to four pins
+     *
+     * @param pin0 First analog input
+     * @param pin1 - pin3 (optional) Further inputs on the same ADC
+     */
+    AnalogInStream(PinName pin0, PinName pin1 = NC, PinName pin2 = NC, PinName pin3 = NC);
+
+    virtual ~AnalogInStream();
+
+    /** Start sampling
+     *
+     * @param rate Frames per second, each frame converts every input once
+     * @param buffer Sample buffer, with room for length samples of the given format
+     * @param length Number of samples in the buffer, a multiple of twice the number of inputs
+     * @param callback Called from interrupt context as each half of the buffer fills
+     * @param format Sample format
+     *
+     * @returns
+     *   0 on success,
+     *   -1 if the rate or buffer length is not supported
+     */
+    int start(uint32_t rate, void *buffer, int length, const block_callback_t &callback,
+              AnalogInFormat format = AnalogInFormatU16);
+
+    /** Stop sampling, the inputs can then be read with AnalogIn
+     */
+    void stop();
+
+    /** Check if sampling is running
+     */
+    bool running() const {
+        return _instance == this;
+    }
+
+    /** Number of samples lost since start() because the ADC interrupt was held off
+     */
+    uint32_t overruns() const {
+        return analogin_stream_overruns();
+    }
+
+protected:
+    static void _irq_handler(uint32_t id, int half);
+
+    analogin_t _channels[4];
+    int _count;
+    char *_buffer;
+    int _half_bytes;
+    int _half_length;
+    block_callback_t _callback;
+
+    static AnalogInStream *_instance;
+};
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_BUFFEREDSERIAL_H
+#define MBED_BUFFEREDSERIAL_H
+
+#include "platform.h"
+
+#if DEVICE_SERIAL
+
+#include "Stream.h"
+#include "SerialBase.h"
+#include "serial_api.h"
+
+namespace mbed {
+
+/** A serial port (UART) with interrupt driven transmit and receive buffers
+ *
+ * Writes copy into the transmit buffer and return without waiting for the
+ * characters to go out, unless the buffer is full. Received characters are
+ * moved into the receive buffer from the receive interrupt. Targets with
+ * DEVICE_SERIAL_BLOCK move whole FIFOs per interrupt.
+ *
+ * The receive and transmit interrupts are used by the class, attach() must
+ * not be used on a BufferedSerial.
+ *
+ * Example:
+ * @code
+ * // Stream telemetry frames to a host
+ *
+ * #include "mbed.h"
+ *
+ * BufferedSerial uplink(p9, p10, 1024);
+ * char frame[64];
+ *
+ * int main() {
+ *     uplink.baud(921600);
+ *     while (1) {
+ *         uplink.write(frame, sizeof(frame));
+ *     }
+ * }
+ * @endcode
+ */
+class BufferedSerial : public SerialBase, public Stream {
+
+public:
+    /** Create a buffered serial port, connected to the specified transmit and receive pins
+     *
+     *  @param tx Transmit pin
+     *  @param rx Receive pin
+     *  @param tx_size Size of the transmit buffer in bytes
+     *  @param rx_size Size of the receive buffer in bytes
+     *
+     *  @note
+     *    Either tx or rx may be specified as NC if unused
+     */
+    BufferedSerial(PinName tx, PinName rx, int tx_size = 256, int rx_size = 256, const char *name=NULL);
+
+    virtual ~BufferedSerial();
+
+    /** Copy characters into the transmit buffer
+     *
+     *  Blocks only while the transmit buffer is full.
+     *
+     *  @returns the number of characters written
+     */
+    virtual ssize_t write(const void *buffer, size_t length);
+
+    /** Copy characters out of the receive buffer
+     *
+     *  Blocks until at least one character has been received, then returns
+     *  what is available up to length.
+     *
+     *  @returns the number of characters read
+     */
+    virtual ssize_t read(void *buffer, size_t length);
+
+    int putc(int c) {
+        return _putc(c);
+    }
+
+    int getc() {
+        return _getc();
+    }
+
+    /** Determine if there is a character in the receive buffer
+     */
+    int readable() const {
+        return _rx_head != _rx_tail;
+    }
+
+    /** Determine if there is space in the transmit buffer
+     */
+    int writeable() const {
+        int head = _tx_head + 1;
+        return ((head == _tx_size) ? 0 : head) != _tx_tail;
+    }
+
+    /** Number of times the UART dropped received characters because the
+     *  receive interrupt was serviced too late
+     */
+    uint32_t rx_overruns() const {
+        return _rx_overruns;
+    }
+
+    /** Number of received characters dropped because the receive buffer was full
+     */
+    uint32_t rx_dropped() const {
+        return _rx_dropped;
+    }
+
+protected:
+    virtual int _getc();
+    virtual int _putc(int c);
+    virtual int fsync();
+
+    void rx_irq();
+    void tx_irq();
+    void tx_start();
+    void tx_fill();
+
+    char *_tx_buf;
+    int _tx_size;
+    volatile int _tx_head;
+    volatile int _tx_tail;
+    volatile bool _tx_busy;
+
+    char *_rx_buf;
+    int _rx_size;
+    volatile int _rx_head;
+    volatile int _rx_tail;
+
+    volatile uint32_t _rx_overruns;
+    volatile uint32_t _rx_dropped;
+};
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -0,0 +1,559 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_CALLBACK_H
+#define MBED_CALLBACK_H
+
+#include <string.h>
+#include "error.h"
+
+namespace mbed {
+
+/** A callback is a copyable, heap-free function object for static functions,
+ *  member functions and static functions bound to a context pointer.
+ *
+ *  The target is stored inline (no allocation) and called through a single
+ *  indirect call. Up to 3 arguments are supported:
+ *  Callback<void()>, Callback<int(char)>, Callback<void(int, int)>, ...
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * class Counter {
+ * public:
+ *     Counter() : count(0) {}
+ *     void add(int n) { count += n; }
+ *     int count;
+ * };
+ *
+ * void log_value(Serial *pc, int n) {
+ *     pc->printf("%d\n", n);
+ * }
+ *
+ * Serial pc(USBTX, USBRX);
+ * Counter counter;
+ *
+ * int main() {
+ *     Callback<void(int)> cb1(&counter, &Counter::add);
+ *     Callback<void(int)> cb2(&pc, &log_value);
+ *     cb1.call(5);
+ *     cb2.call(counter.count);
+ * }
+ * @endcode
+ */
+template <typename F>
+class Callback;
+
+/* Inline storage for the attached function. A member function pointer is
+   copied into the raw storage and restored with its type by the thunk. */
+class CallbackDummy;
+typedef union {
+    void (*_static)();
+    void (CallbackDummy::*_method)();
+    void *_align[2];
+} callback_storage_t;
+
+inline void callback_store_method(callback_storage_t *storage, const void *method, size_t size) {
+    if (size > sizeof(callback_storage_t)) {
+        error("Member function pointer does not fit in a Callback\r\n");
+    }
+    memset(storage, 0, sizeof(callback_storage_t));
+    memcpy(storage, method, size);
+}
+
+/** Callback class for functions taking 0 arguments
+ */
+template <typename R>
+class Callback<R()> {
+public:
+    /** Create a Callback with a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    Callback(R (*func)() = 0) {
+        attach(func);
+    }
+
+    /** Create a Callback with a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (T::*method)()) {
+        attach(obj, method);
+    }
+
+    /** Create a Callback with a static function and a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (*func)(T*)) {
+        attach(obj, func);
+    }
+
+    /** Attach a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    void attach(R (*func)() = 0) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = 0;
+        _thunk = func ? &Callback::function_thunk : &Callback::empty_thunk;
+    }
+
+    /** Attach a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (T::*method)()) {
+        callback_store_method(&_func, &method, sizeof(method));
+        _obj = (void*)obj;
+        _thunk = &Callback::template method_thunk<T>;
+    }
+
+    /** Attach a static function with a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (*func)(T*)) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = (void*)obj;
+        _thunk = &Callback::template context_thunk<T>;
+    }
+
+    /** Call the attached function, nothing is called (and R() is returned) if none is attached
+     */
+    R call() const {
+        return _thunk(this);
+    }
+
+    /** Check whether a function is attached
+     */
+    bool attached() const {
+        return _thunk != &Callback::empty_thunk;
+    }
+
+    /** Check whether two callbacks call the same function on the same object
+     */
+    bool operator==(const Callback &other) const {
+        return (_thunk == other._thunk) && (_obj == other._obj) &&
+               (memcmp(&_func, &other._func, sizeof(_func)) == 0);
+    }
+
+#ifdef MBED_OPERATORS
+    R operator ()() const {
+        return call();
+    }
+#endif
+
+private:
+    static R empty_thunk(const Callback *cb) {
+        return R();
+    }
+
+    static R function_thunk(const Callback *cb) {
+        return ((R (*)())cb->_func._static)();
+    }
+
+    template<typename T>
+    static R method_thunk(const Callback *cb) {
+        R (T::*method)();
+        memcpy(&method, &cb->_func, sizeof(method));
+        return (((T*)cb->_obj)->*method)();
+    }
+
+    template<typename T>
+    static R context_thunk(const Callback *cb) {
+        return ((R (*)(T*))cb->_func._static)((T*)cb->_obj);
+    }
+
+    callback_storage_t _func;     // static function or raw member function pointer
+    void *_obj;                   // object or bound context - 0 if none
+    R (*_thunk)(const Callback*); // converts _func back and calls it
+};
+
+/** Callback class for functions taking 1 argument
+ */
+template <typename R, typename A0>
+class Callback<R(A0)> {
+public:
+    /** Create a Callback with a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    Callback(R (*func)(A0) = 0) {
+        attach(func);
+    }
+
+    /** Create a Callback with a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (T::*method)(A0)) {
+        attach(obj, method);
+    }
+
+    /** Create a Callback with a static function and a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (*func)(T*, A0)) {
+        attach(obj, func);
+    }
+
+    /** Attach a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    void attach(R (*func)(A0) = 0) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = 0;
+        _thunk = func ? &Callback::function_thunk : &Callback::empty_thunk;
+    }
+
+    /** Attach a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (T::*method)(A0)) {
+        callback_store_method(&_func, &method, sizeof(method));
+        _obj = (void*)obj;
+        _thunk = &Callback::template method_thunk<T>;
+    }
+
+    /** Attach a static function with a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (*func)(T*, A0)) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = (void*)obj;
+        _thunk = &Callback::template context_thunk<T>;
+    }
+
+    /** Call the attached function, nothing is called (and R() is returned) if none is attached
+     */
+    R call(A0 a0) const {
+        return _thunk(this, a0);
+    }
+
+    /** Check whether a function is attached
+     */
+    bool attached() const {
+        return _thunk != &Callback::empty_thunk;
+    }
+
+    /** Check whether two callbacks call the same function on the same object
+     */
+    bool operator==(const Callback &other) const {
+        return (_thunk == other._thunk) && (_obj == other._obj) &&
+               (memcmp(&_func, &other._func, sizeof(_func)) == 0);
+    }
+
+#ifdef MBED_OPERATORS
+    R operator ()(A0 a0) const {
+        return call(a0);
+    }
+#endif
+
+private:
+    static R empty_thunk(const Callback *cb, A0 a0) {
+        return R();
+    }
+
+    static R function_thunk(const Callback *cb, A0 a0) {
+        return ((R (*)(A0))cb->_func._static)(a0);
+    }
+
+    template<typename T>
+    static R method_thunk(const Callback *cb, A0 a0) {
+        R (T::*method)(A0);
+        memcpy(&method, &cb->_func, sizeof(method));
+        return (((T*)cb->_obj)->*method)(a0);
+    }
+
+    template<typename T>
+    static R context_thunk(const Callback *cb, A0 a0) {
+        return ((R (*)(T*, A0))cb->_func._static)((T*)cb->_obj, a0);
+    }
+
+    callback_storage_t _func;     // static function or raw member function pointer
+    void *_obj;                   // object or bound context - 0 if none
+    R (*_thunk)(const Callback*, A0); // converts _func back and calls it
+};
+
+/** Callback class for functions taking 2 arguments
+ */
+template <typename R, typename A0, typename A1>
+class Callback<R(A0, A1)> {
+public:
+    /** Create a Callback with a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    Callback(R (*func)(A0, A1) = 0) {
+        attach(func);
+    }
+
+    /** Create a Callback with a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (T::*method)(A0, A1)) {
+        attach(obj, method);
+    }
+
+    /** Create a Callback with a static function and a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (*func)(T*, A0, A1)) {
+        attach(obj, func);
+    }
+
+    /** Attach a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    void attach(R (*func)(A0, A1) = 0) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = 0;
+        _thunk = func ? &Callback::function_thunk : &Callback::empty_thunk;
+    }
+
+    /** Attach a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (T::*method)(A0, A1)) {
+        callback_store_method(&_func, &method, sizeof(method));
+        _obj = (void*)obj;
+        _thunk = &Callback::template method_thunk<T>;
+    }
+
+    /** Attach a static function with a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (*func)(T*, A0, A1)) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = (void*)obj;
+        _thunk = &Callback::template context_thunk<T>;
+    }
+
+    /** Call the attached function, nothing is called (and R() is returned) if none is attached
+     */
+    R call(A0 a0, A1 a1) const {
+        return _thunk(this, a0, a1);
+    }
+
+    /** Check whether a function is attached
+     */
+    bool attached() const {
+        return _thunk != &Callback::empty_thunk;
+    }
+
+    /** Check whether two callbacks call the same function on the same object
+     */
+    bool operator==(const Callback &other) const {
+        return (_thunk == other._thunk) && (_obj == other._obj) &&
+               (memcmp(&_func, &other._func, sizeof(_func)) == 0);
+    }
+
+#ifdef MBED_OPERATORS
+    R operator ()(A0 a0, A1 a1) const {
+        return call(a0, a1);
+    }
+#endif
+
+private:
+    static R empty_thunk(const Callback *cb, A0 a0, A1 a1) {
+        return R();
+    }
+
+    static R function_thunk(const Callback *cb, A0 a0, A1 a1) {
+        return ((R (*)(A0, A1))cb->_func._static)(a0, a1);
+    }
+
+    template<typename T>
+    static R method_thunk(const Callback *cb, A0 a0, A1 a1) {
+        R (T::*method)(A0, A1);
+        memcpy(&method, &cb->_func, sizeof(method));
+        return (((T*)cb->_obj)->*method)(a0, a1);
+    }
+
+    template<typename T>
+    static R context_thunk(const Callback *cb, A0 a0, A1 a1) {
+        return ((R (*)(T*, A0, A1))cb->_func._static)((T*)cb->_obj, a0, a1);
+    }
+
+    callback_storage_t _func;     // static function or raw member function pointer
+    void *_obj;                   // object or bound context - 0 if none
+    R (*_thunk)(const Callback*, A0, A1); // converts _func back and calls it
+};
+
+/** Callback class for functions taking 3 arguments
+ */
+template <typename R, typename A0, typename A1, typename A2>
+class Callback<R(A0, A1, A2)> {
+public:
+    /** Create a Callback with a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    Callback(R (*func)(A0, A1, A2) = 0) {
+        attach(func);
+    }
+
+    /** Create a Callback with a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (T::*method)(A0, A1, A2)) {
+        attach(obj, method);
+    }
+
+    /** Create a Callback with a static function and a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    Callback(T *obj, R (*func)(T*, A0, A1, A2)) {
+        attach(obj, func);
+    }
+
+    /** Attach a static function
+     *
+     *  @param func Static function to attach (default is none)
+     */
+    void attach(R (*func)(A0, A1, A2) = 0) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = 0;
+        _thunk = func ? &Callback::function_thunk : &Callback::empty_thunk;
+    }
+
+    /** Attach a member function
+     *
+     *  @param obj Pointer to the object to call the member function on
+     *  @param method Member function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (T::*method)(A0, A1, A2)) {
+        callback_store_method(&_func, &method, sizeof(method));
+        _obj = (void*)obj;
+        _thunk = &Callback::template method_thunk<T>;
+    }
+
+    /** Attach a static function with a bound context pointer
+     *
+     *  @param obj Pointer passed as the first argument of the function
+     *  @param func Static function to attach
+     */
+    template<typename T>
+    void attach(T *obj, R (*func)(T*, A0, A1, A2)) {
+        memset(&_func, 0, sizeof(_func));
+        _func._static = (void (*)())func;
+        _obj = (void*)obj;
+        _thunk = &Callback::template context_thunk<T>;
+    }
+
+    /** Call the attached function, nothing is called (and R() is returned) if none is attached
+     */
+    R call(A0 a0, A1 a1, A2 a2) const {
+        return _thunk(this, a0, a1, a2);
+    }
+
+    /** Check whether a function is attached
+     */
+    bool attached() const {
+        return _thunk != &Callback::empty_thunk;
+    }
+
+    /** Check whether two callbacks call the same function on the same object
+     */
+    bool operator==(const Callback &other) const {
+        return (_thunk == other._thunk) && (_obj == other._obj) &&
+               (memcmp(&_func, &other._func, sizeof(_func)) == 0);
+    }
+
+#ifdef MBED_OPERATORS
+    R operator ()(A0 a0, A1 a1, A2 a2) const {
+        return call(a0, a1, a2);
+    }
+#endif
+
+private:
+    static R empty_thunk(const Callback *cb, A0 a0, A1 a1, A2 a2) {
+        return R();
+    }
+
+    static R function_thunk(const Callback *cb, A0 a0, A1 a1, A2 a2) {
+        return ((R (*)(A0, A1, A2))cb->_func._static)(a0, a1, a2);
+    }
+
+    template<typename T>
+    static R method_thunk(const Callback *cb, A0 a0, A1 a1, A2 a2) {
+        R (T::*method)(A0, A1, A2);
+        memcpy(&method, &cb->_func, sizeof(method));
+        return (((T*)cb->_obj)->*method)(a0, a1, a2);
+    }
+
+    template<typename T>
+    static R context_thunk(const Callback *cb, A0 a0, A1 a1, A2 a2) {
+        return ((R (*)(T*, A0, A1, A2))cb->_func._static)((T*)cb->_obj, a0, a1, a2);
+    }
+
+    callback_storage_t _func;     // static function or raw member function pointer
+    void *_obj;                   // object or bound context - 0 if none
+    R (*_thunk)(const Callback*, A0, A1, A2); // converts _func back and calls it
+};
+
+} // namespace mbed
+
+#endif
@@ -20,6 +20,9 @@
 #   define NAME_MAX 255
 typedef int mode_t;
 
+#elif defined(TOOLCHAIN_GCC_NATIVE)
+#   include <limits.h>
+
 #else
 #   include <sys/syslimits.h>
 #endif
@@ -0,0 +1,196 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_EVENT_H
+#define MBED_EVENT_H
+
+#include "TimerEvent.h"
+#include "FunctionPointer.h"
+
+namespace mbed {
+
+class EventQueue;
+
+/** A callback whose call is deferred to the thread or loop dispatching an EventQueue
+ *
+ *  Posting an Event is safe from interrupt context and never blocks; the
+ *  attached function then runs the next time the queue is dispatched. An
+ *  Event that is posted again before it was dispatched runs only once.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * EventQueue queue;
+ * InterruptIn button(p5);
+ * DigitalOut led(LED1);
+ *
+ * void toggle() {
+ *     led = !led;
+ * }
+ *
+ * Event pressed(&queue, &toggle);
+ *
+ * int main() {
+ *     button.rise(&pressed);   // toggle() runs from main, not from the ISR
+ *     queue.dispatch();
+ * }
+ * @endcode
+ */
+class Event : public TimerEvent {
+    friend class EventQueue;
+
+public:
+    /** Create an Event dispatched by queue, attaching a static function
+     *
+     *  @param queue The EventQueue the event is posted to
+     *  @param fptr The void static function to attach (default is none)
+     */
+    Event(EventQueue *queue, void (*fptr)(void) = 0);
+
+    /** Create an Event dispatched by queue, attaching a member function
+     *
+     *  @param queue The EventQueue the event is posted to
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    Event(EventQueue *queue, T *tptr, void (T::*mptr)(void)) {
+        init(queue);
+        _function.attach(tptr, mptr);
+    }
+
+    /** Cancel the event, removing it from its queue
+     */
+    virtual ~Event();
+
+    /** Attach a static function
+     *
+     *  @param fptr The void static function to attach (default is none)
+     */
+    void attach(void (*fptr)(void) = 0) {
+        _function.attach(fptr);
+    }
+
+    /** Attach a member function
+     *
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    void attach(T *tptr, void (T::*mptr)(void)) {
+        _function.attach(tptr, mptr);
+    }
+
+    /** Attach a static function called after each dispatch, or in place of a dispatch dropped by cancel()
+     *
+     *  Used by drivers which mask their interrupt until the deferred handler ran.
+     *
+     *  @param fptr The void static function to attach (default is none)
+     */
+    void attach_done(void (*fptr)(void) = 0) {
+        _done.attach(fptr);
+    }
+
+    /** Attach a member function called after each dispatch, or in place of a dispatch dropped by cancel()
+     *
+     *  Used by drivers which mask their interrupt until the deferred handler ran.
+     *
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    void attach_done(T *tptr, void (T::*mptr)(void)) {
+        _done.attach(tptr, mptr);
+    }
+
+    /** Post the event to its queue (interrupt safe)
+     */
+    void post();
+
+    /** Post the event to its queue after a delay
+     *
+     *  @param us the delay in micro-seconds
+     */
+    void post_in(us_timestamp_t us);
+
+    /** Post the event to its queue periodically
+     *
+     *  @param us the period in micro-seconds
+     */
+    void post_every(us_timestamp_t us);
+
+    /** Stop any delayed or periodic post, and drop a dispatch still pending
+     *
+     *  The done function is called in place of a dropped dispatch. A dispatch
+     *  already running is not affected.
+     */
+    void cancel();
+
+    /** Number of times the event was dispatched
+     */
+    uint32_t dispatch_count() const {
+        return _count;
+    }
+
+    /** Number of posts merged with one already pending
+     */
+    uint32_t missed_count() const {
+        return _missed;
+    }
+
+    /** Shortest delay between a post and its dispatch, in micro-seconds
+     */
+    uint32_t latency_min() const {
+        return _count ? _latency_min : 0;
+    }
+
+    /** Longest delay between a post and its dispatch, in micro-seconds
+     */
+    uint32_t latency_max() const {
+        return _latency_max;
+    }
+
+    /** Average delay between a post and its dispatch, in micro-seconds
+     */
+    uint32_t latency_mean() const {
+        return _count ? (uint32_t)(_latency_total / _count) : 0;
+    }
+
+    /** Clear the dispatch statistics
+     */
+    void reset_stats();
+
+protected:
+    void init(EventQueue *queue);
+    virtual void handler();
+
+    EventQueue *_queue;
+    FunctionPointer _function;
+    FunctionPointer _done;
+    us_timestamp_t _period;          // 0 unless posted with post_every
+    Event *volatile _next;           // link in the queue pending or ready list
+    volatile uint32_t _pending;      // set while waiting in the queue
+    uint32_t _posted;                // us_ticker time of the last post
+    uint32_t _count;
+    uint32_t _missed;
+    uint32_t _latency_min;
+    uint32_t _latency_max;
+    uint64_t _latency_total;
+};
+
+} // namespace mbed
+
+#endif
@@ -0,0 +1,116 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_EVENTQUEUE_H
+#define MBED_EVENTQUEUE_H
+
+#include "Event.h"
+#include "FunctionPointer.h"
+
+namespace mbed {
+
+/** A queue of deferred callbacks, moving work out of interrupt handlers
+ *
+ *  Events are posted from any context, interrupts included, without locking
+ *  and without allocation. They are run, in posting order, by the thread or
+ *  main loop calling dispatch().
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * EventQueue queue;
+ * DigitalOut led(LED1);
+ *
+ * void blink() {
+ *     led = !led;
+ * }
+ *
+ * Event blinker(&queue, &blink);
+ *
+ * int main() {
+ *     blinker.post_every(500000);
+ *     queue.dispatch();
+ * }
+ * @endcode
+ */
+class EventQueue {
+    friend class Event;
+
+public:
+    EventQueue();
+
+    /** Post an event (interrupt safe)
+     *
+     *  @param event The event to post
+     *
+     *  @returns
+     *    true if the event was queued,
+     *    false if it was already pending
+     */
+    bool post(Event *event);
+
+    /** Run the events pending in the queue
+     *
+     *  @returns the number of events dispatched
+     */
+    int dispatch_pending();
+
+    /** Run events as they are posted
+     *
+     *  Sleeps with __WFI() while the queue is empty. From an RTOS thread,
+     *  prefer dispatch_pending() on a signal raised by the notify function.
+     *
+     *  @param ms the time to dispatch for in milli-seconds, or -1 to dispatch forever
+     */
+    void dispatch(int ms = -1);
+
+    /** Attach a function called, from the posting context, whenever an event is queued
+     *
+     *  @param fptr The void static function to attach (default is none)
+     */
+    void notify(void (*fptr)(void) = 0) {
+        _notify.attach(fptr);
+    }
+
+    /** Attach a member function called, from the posting context, whenever an event is queued
+     *
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    void notify(T *tptr, void (T::*mptr)(void)) {
+        _notify.attach(tptr, mptr);
+    }
+
+    /** Longest delay between a post and its dispatch over all events, in micro-seconds
+     */
+    uint32_t latency_max() const {
+        return _latency_max;
+    }
+
+protected:
+    bool unlink(Event *event);
+
+    Event *volatile _head;   // events posted and not yet dispatched, newest first
+    Event *_ready;           // events taken by dispatch_pending(), oldest first
+    Event *_ready_tail;
+    FunctionPointer _notify;
+    uint32_t _latency_max;
+};
+
+} // namespace mbed
+
+#endif
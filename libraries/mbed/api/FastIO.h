@@ -0,0 +1,347 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_FASTIO_H
+#define MBED_FASTIO_H
+
+#include "platform.h"
+#include "gpio_api.h"
+
+namespace mbed {
+
+/** A digital output resolved at compile time
+ *
+ * On targets defining GPIO_FAST_IO the port register and mask of the pin
+ * are constants, so write() compiles to a single store. Other targets fall
+ * back to the gpio_t based calls used by DigitalOut.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * FastOut<LED1> led;
+ *
+ * int main() {
+ *     while (1) {
+ *         led.toggle();
+ *     }
+ * }
+ * @endcode
+ */
+template <PinName pin>
+class FastOut {
+public:
+    /** Create a FastOut, set low
+     */
+    FastOut() {
+#if defined(GPIO_FAST_IO)
+        // the registers are constants, the gpio_t is only needed to set the pin up
+        gpio_t _gpio;
+#endif
+        gpio_init_out(&_gpio, pin);
+    }
+
+    /** Create a FastOut with an initial value
+     */
+    FastOut(int value) {
+#if defined(GPIO_FAST_IO)
+        gpio_t _gpio;
+#endif
+        gpio_init_out_ex(&_gpio, pin, value);
+    }
+
+    /** Set the output, 0 for logical 0, 1 (or any other non-zero value) for logical 1
+     */
+    void write(int value) {
+#if defined(GPIO_FAST_IO)
+        if (value) {
+            gpio_fast_write(PORT, MASK, 0);
+        } else {
+            gpio_fast_write(PORT, 0, MASK);
+        }
+#else
+        gpio_write(&_gpio, value);
+#endif
+    }
+
+    /** Return the output setting, 0 for logical 0, 1 for logical 1
+     */
+    int read() {
+#if defined(GPIO_FAST_IO)
+        return (gpio_fast_output(PORT) & MASK) ? 1 : 0;
+#else
+        return gpio_read(&_gpio);
+#endif
+    }
+
+    /** Invert the output
+     */
+    void toggle() {
+#if defined(GPIO_FAST_IO)
+        gpio_fast_toggle(PORT, MASK);
+#else
+        gpio_write(&_gpio, !gpio_read(&_gpio));
+#endif
+    }
+
+#ifdef MBED_OPERATORS
+    /** A shorthand for write()
+     */
+    FastOut& operator= (int value) {
+        write(value);
+        return *this;
+    }
+
+    /** A shorthand for read()
+     */
+    operator int() {
+        return read();
+    }
+#endif
+
+private:
+#if defined(GPIO_FAST_IO)
+    static const uint32_t PORT = GPIO_FAST_PORT(pin);
+    static const uint32_t MASK = 1UL << GPIO_FAST_BIT(pin);
+
+#else
+    gpio_t _gpio;
+#endif
+};
+
+/** A digital input resolved at compile time
+ */
+template <PinName pin>
+class FastIn {
+public:
+    /** Create a FastIn with the given pin mode
+     */
+    FastIn(PinMode mode = PullDefault) {
+#if defined(GPIO_FAST_IO)
+        gpio_t _gpio;
+#endif
+        gpio_init_in_ex(&_gpio, pin, mode);
+    }
+
+    /** Read the input, 0 for logical 0, 1 for logical 1
+     */
+    int read() {
+#if defined(GPIO_FAST_IO)
+        return (gpio_fast_read(PORT) & MASK) ? 1 : 0;
+#else
+        return gpio_read(&_gpio);
+#endif
+    }
+
+#ifdef MBED_OPERATORS
+    /** An operator shorthand for read()
+     */
+    operator int() {
+        return read();
+    }
+#endif
+
+private:
+#if defined(GPIO_FAST_IO)
+    static const uint32_t PORT = GPIO_FAST_PORT(pin);
+    static const uint32_t MASK = 1UL << GPIO_FAST_BIT(pin);
+
+#else
+    gpio_t _gpio;
+#endif
+};
+
+/** One bit of a FastBus, compiled out for NC pins
+ */
+template <PinName pin, int bit>
+struct FastBusBit {
+#if defined(GPIO_FAST_IO)
+    static const uint32_t PORT = (pin == NC) ? 0 : GPIO_FAST_PORT(pin);
+    static const uint32_t MASK = (pin == NC) ? 0 : (1UL << GPIO_FAST_BIT(pin));
+
+    // The mask of the pin if its bit is set in value
+    static uint32_t set(int value) {
+        return (value & (1 << bit)) ? MASK : 0;
+    }
+
+    // Bit of the bus value if the pin is set in port_value
+    static int get(uint32_t port_value) {
+        return (port_value & MASK) ? (1 << bit) : 0;
+    }
+
+    static void write(int value) {
+        if (pin != NC) {
+            if (value & (1 << bit)) {
+                gpio_fast_write(PORT, MASK, 0);
+            } else {
+                gpio_fast_write(PORT, 0, MASK);
+            }
+        }
+    }
+
+    static int read() {
+        return (pin != NC) ? get(gpio_fast_output(PORT)) : 0;
+    }
+
+    // The pin sits at the given offset from bit 0 of the bus, on the same port
+    static bool in_order(uint32_t port, uint32_t bit0) {
+        return (pin == NC) || ((PORT == port) && (GPIO_FAST_BIT(pin) == bit0 + bit));
+    }
+#endif
+
+    static void init(gpio_t *gpio) {
+        if (pin != NC) {
+            gpio_init_out(gpio, pin);
+        }
+    }
+};
+
+#define FASTBUS_PINS(X) \
+    X(p0, 0) X(p1, 1) X(p2, 2) X(p3, 3) X(p4, 4) X(p5, 5) X(p6, 6) X(p7, 7) \
+    X(p8, 8) X(p9, 9) X(p10, 10) X(p11, 11) X(p12, 12) X(p13, 13) X(p14, 14) X(p15, 15)
+
+/** A digital output bus of up to 16 pins resolved at compile time
+ *
+ * When all pins are on one port the bus is written with a single masked
+ * port access, and when they also sit on consecutive bits in order the
+ * value is shifted into place instead of spread bit by bit.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * FastBus<p21, p22, p23, p24> nibble;
+ *
+ * int main() {
+ *     for (int i = 0; ; i++) {
+ *         nibble = i;
+ *     }
+ * }
+ * @endcode
+ */
+template <PinName p0, PinName p1 = NC, PinName p2 = NC, PinName p3 = NC,
+          PinName p4 = NC, PinName p5 = NC, PinName p6 = NC, PinName p7 = NC,
+          PinName p8 = NC, PinName p9 = NC, PinName p10 = NC, PinName p11 = NC,
+          PinName p12 = NC, PinName p13 = NC, PinName p14 = NC, PinName p15 = NC>
+class FastBus {
+public:
+    /** Create a FastBus, all pins set low
+     */
+    FastBus() {
+#if defined(GPIO_FAST_IO)
+        gpio_t gpio;
+#define FASTBUS_INIT(p, i) FastBusBit<p, i>::init(&gpio);
+#else
+#define FASTBUS_INIT(p, i) FastBusBit<p, i>::init(&_gpio[i]);
+#endif
+        FASTBUS_PINS(FASTBUS_INIT)
+#undef FASTBUS_INIT
+    }
+
+    /** Write the value to the output bus, bit n of value driving pn
+     */
+    void write(int value) {
+#if defined(GPIO_FAST_IO)
+        if (same_port()) {
+            uint32_t set;
+            if (in_order()) {
+                set = ((uint32_t)value << GPIO_FAST_BIT(p0)) & MASK;
+            } else {
+#define FASTBUS_SET(p, i) | FastBusBit<p, i>::set(value)
+                set = 0 FASTBUS_PINS(FASTBUS_SET);
+#undef FASTBUS_SET
+            }
+            gpio_fast_write(PORT, set, MASK & ~set);
+        } else {
+#define FASTBUS_WRITE(p, i) FastBusBit<p, i>::write(value);
+            FASTBUS_PINS(FASTBUS_WRITE)
+#undef FASTBUS_WRITE
+        }
+#else
+#define FASTBUS_WRITE(p, i) if (p != NC) gpio_write(&_gpio[i], (value >> i) & 1);
+        FASTBUS_PINS(FASTBUS_WRITE)
+#undef FASTBUS_WRITE
+#endif
+    }
+
+    /** Read the value currently output on the bus
+     */
+    int read() {
+#if defined(GPIO_FAST_IO)
+        if (same_port()) {
+            uint32_t port_value = gpio_fast_output(PORT);
+            if (in_order())
+                return (port_value & MASK) >> GPIO_FAST_BIT(p0);
+#define FASTBUS_GET(p, i) | FastBusBit<p, i>::get(port_value)
+            return 0 FASTBUS_PINS(FASTBUS_GET);
+#undef FASTBUS_GET
+        }
+#define FASTBUS_READ(p, i) | FastBusBit<p, i>::read()
+        return 0 FASTBUS_PINS(FASTBUS_READ);
+#undef FASTBUS_READ
+#else
+        int value = 0;
+#define FASTBUS_READ(p, i) if (p != NC) value |= gpio_read(&_gpio[i]) << i;
+        FASTBUS_PINS(FASTBUS_READ)
+#undef FASTBUS_READ
+        return value;
+#endif
+    }
+
+#ifdef MBED_OPERATORS
+    /** A shorthand for write()
+     */
+    FastBus& operator= (int value) {
+        write(value);
+        return *this;
+    }
+
+    /** A shorthand for read()
+     */
+    operator int() {
+        return read();
+    }
+#endif
+
+private:
+#if defined(GPIO_FAST_IO)
+    static const uint32_t PORT = GPIO_FAST_PORT(p0);
+#define FASTBUS_MASK(p, i) | FastBusBit<p, i>::MASK
+    static const uint32_t MASK = 0 FASTBUS_PINS(FASTBUS_MASK);
+#undef FASTBUS_MASK
+
+    // All pins on the port of p0, constant folded
+    static bool same_port() {
+#define FASTBUS_SAME_PORT(p, i) && (p == NC || FastBusBit<p, i>::PORT == PORT)
+        return true FASTBUS_PINS(FASTBUS_SAME_PORT);
+#undef FASTBUS_SAME_PORT
+    }
+
+    // Pin n on bit n of the port counted from p0, constant folded
+    static bool in_order() {
+#define FASTBUS_IN_ORDER(p, i) && FastBusBit<p, i>::in_order(PORT, GPIO_FAST_BIT(p0))
+        return true FASTBUS_PINS(FASTBUS_IN_ORDER);
+#undef FASTBUS_IN_ORDER
+    }
+#else
+    gpio_t _gpio[16];
+#endif
+};
+
+#undef FASTBUS_PINS
+
+} // namespace mbed
+
+#endif
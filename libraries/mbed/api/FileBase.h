@@ -34,6 +34,11 @@ typedef int mode_t;
 typedef int ssize_t;
 typedef long off_t;
 
+#elif defined(TOOLCHAIN_GCC_NATIVE)
+#    include <fcntl.h>
+#    include <sys/types.h>
+#    include <limits.h>
+
 #else
 #    include <sys/fcntl.h>
 #    include <sys/types.h>
@@ -30,6 +30,8 @@ typedef long off_t;
 
 namespace mbed {
 
+class FileDescriptors;
+
 /** An OO equivalent of the internal FILEHANDLE variable
  *  and associated _sys_* functions.
  *
@@ -42,6 +44,9 @@ namespace mbed {
 class FileHandle {
 
 public:
+    FileHandle() : _fd(-1) {
+    }
+
     /** Write the contents of a buffer to the file
      *
      *  @param buffer the buffer to write from
@@ -112,6 +117,10 @@ public:
     }
 
     virtual ~FileHandle();
+
+private:
+    friend class FileDescriptors;
+    int _fd;    // last descriptor opened on this handle, -1 if none
 };
 
 } // namespace mbed
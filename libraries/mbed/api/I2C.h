@@ -21,6 +21,7 @@
 #if DEVICE_I2C
 
 #include "i2c_api.h"
+#include "Callback.h"
 
 namespace mbed {
 
@@ -40,6 +41,11 @@ namespace mbed {
  *     i2c.read(address, data, 2);
  * }
  * @endcode
+ *
+ * Transactions can also be queued with transfer(), which returns straight
+ * away and reports the end of the transaction to a callback. Transactions
+ * queued from several drivers on the same bus run one after the other, each
+ * at the frequency of the I2C object it was queued on.
  */
 class I2C {
 
@@ -129,12 +135,72 @@ public:
      */
     void stop(void);
 
+    typedef Callback<void(int)> event_callback_t;
+
+    /** A transaction for transfer(): an optional write, then an optional
+     *  read after a repeated start
+     *
+     *  The transaction is owned by the caller and must be left alone until
+     *  its callback has run or it has been aborted.
+     */
+    class Transaction {
+    public:
+        Transaction() : address(0), tx_buffer(NULL), tx_length(0), rx_buffer(NULL), rx_length(0),
+                        callback(), event(I2C_EVENT_ALL), _i2c(NULL), _next(NULL), _state(0) {
+        }
+
+        /** Check whether the transaction is queued or in progress
+         */
+        bool pending() const {
+            return _state != 0;
+        }
+
+        int address;                /**< 8 bit address of the slave */
+        const char *tx_buffer;      /**< Bytes to write */
+        int tx_length;              /**< Number of bytes to write */
+        char *rx_buffer;            /**< Buffer for the bytes read */
+        int rx_length;              /**< Number of bytes to read */
+        event_callback_t callback;  /**< Called from interrupt context when the transaction ends */
+        int event;                  /**< Mask of the I2C_EVENT_ values passed to the callback */
+
+    private:
+        friend class I2C;
+        I2C *_i2c;
+        Transaction *_next;
+        volatile int _state;
+    };
+
+    /** Queue a transaction without blocking
+     *
+     *  The transaction starts as soon as the bus is free. Targets without
+     *  DEVICE_I2C_ASYNCH run the transaction before returning.
+     *
+     *  @param transaction The transaction to run
+     *
+     *  @returns
+     *    0 if the transaction was started or queued,
+     *   -1 if it is already queued
+     */
+    int transfer(Transaction *transaction);
+
+    /** Remove a transaction from the queue, stopping it if it is in
+     *  progress, without calling its callback
+     *
+     *  @param transaction The transaction to abort
+     */
+    void abort_transfer(Transaction *transaction);
+
 protected:
     void aquire();
 
     i2c_t _i2c;
     static I2C  *_owner;
     int         _hz;
+
+    static void start_queued(void);
+    static void irq_handler_asynch(uint32_t id, int event);
+    static void remove(Transaction *transaction);
+    static Transaction *_transactions;
 };
 
 } // namespace mbed
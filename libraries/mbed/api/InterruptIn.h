@@ -26,6 +26,8 @@
 
 namespace mbed {
 
+class Event;
+
 /** A digital interrupt input, used to call a function on a rising or falling edge
  *
  * Example:
@@ -85,6 +87,14 @@ public:
         gpio_irq_set(&gpio_irq, IRQ_RISE, 1);
     }
 
+    /** Post an event to its queue when a rising edge occurs on the input
+     *
+     *  The event's function then runs from the thread dispatching the queue.
+     *
+     *  @param event The event to post, or 0 to set as none
+     */
+    void rise(Event *event);
+
     /** Attach a function to call when a falling edge occurs on the input
      *
      *  @param fptr A pointer to a void function, or 0 to set as none
@@ -102,6 +112,14 @@ public:
         gpio_irq_set(&gpio_irq, IRQ_FALL, 1);
     }
 
+    /** Post an event to its queue when a falling edge occurs on the input
+     *
+     *  The event's function then runs from the thread dispatching the queue.
+     *
+     *  @param event The event to post, or 0 to set as none
+     */
+    void fall(Event *event);
+
     /** Set the input pin mode
      *
      *  @param mode PullUp, PullDown, PullNone
@@ -5,9 +5,26 @@
 #include "CallChain.h"
 #include <string.h>
 
+/** Number of interrupts that can have a handler chain at the same time */
+#ifndef INTERRUPT_MANAGER_CHAINS
+#define INTERRUPT_MANAGER_CHAINS        4
+#endif
+
+/** Number of handlers in each chain, including the original vector */
+#ifndef INTERRUPT_MANAGER_CHAIN_SIZE
+#define INTERRUPT_MANAGER_CHAIN_SIZE    4
+#endif
+
 namespace mbed {
 
 /** Use this singleton if you need to chain interrupt handlers.
+ *
+ * The first handler added to an interrupt is chained after the handler
+ * already in the vector table. Chains are kept in a fixed pool of
+ * INTERRUPT_MANAGER_CHAINS arrays of INTERRUPT_MANAGER_CHAIN_SIZE handlers,
+ * so adding never allocates, and fails once the pool or a chain is full.
+ * When removing handlers leaves a single plain function, it is installed
+ * directly in the vector table again and the chain is released.
  *
  * Example (for LPC1768):
  * @code
@@ -49,7 +66,7 @@ public:
      *  @param irq interrupt number
      *
      *  @returns
-     *  The function object created for 'function'
+     *  The function object created for 'function', or NULL if no room is left
      */
     pFunctionPointer_t add_handler(void (*function)(void), IRQn_Type irq) {
         return add_common(function, irq);
@@ -61,7 +78,7 @@ public:
      *  @param irq interrupt number
      *
      *  @returns
-     *  The function object created for 'function'
+     *  The function object created for 'function', or NULL if no room is left
      */
     pFunctionPointer_t add_handler_front(void (*function)(void), IRQn_Type irq) {
         return add_common(function, irq, true);
@@ -74,7 +91,7 @@ public:
      *  @param irq interrupt number
      *
      *  @returns
-     *  The function object created for 'tptr' and 'mptr'
+     *  The function object created for 'tptr' and 'mptr', or NULL if no room is left
      */
     template<typename T>
     pFunctionPointer_t add_handler(T* tptr, void (T::*mptr)(void), IRQn_Type irq) {
@@ -88,7 +105,7 @@ public:
      *  @param irq interrupt number
      *
      *  @returns
-     *  The function object created for 'tptr' and 'mptr'
+     *  The function object created for 'tptr' and 'mptr', or NULL if no room is left
      */
     template<typename T>
     pFunctionPointer_t add_handler_front(T* tptr, void (T::*mptr)(void), IRQn_Type irq) {
@@ -115,25 +132,31 @@ private:
     InterruptManager(const InterruptManager&);
     InterruptManager& operator =(const InterruptManager&);
 
+    // Handlers stay in their slot for as long as they are attached, so
+    // the pointers handed out remain valid; calls holds them in call order
+    struct Chain {
+        int size;                   // 0 while the chain is in the pool
+        uint32_t vector;            // vector installed before the chain
+        pFunctionPointer_t calls[INTERRUPT_MANAGER_CHAIN_SIZE];
+        FunctionPointer handlers[INTERRUPT_MANAGER_CHAIN_SIZE];
+    };
+
     template<typename T>
     pFunctionPointer_t add_common(T *tptr, void (T::*mptr)(void), IRQn_Type irq, bool front=false) {
-        int irq_pos = get_irq_index(irq);
-        bool change = must_replace_vector(irq);
+        return add_common(FunctionPointer(tptr, mptr), irq, front);
+    }
 
-        pFunctionPointer_t pf = front ? _chains[irq_pos]->add_front(tptr, mptr) : _chains[irq_pos]->add(tptr, mptr);
-        if (change)
-            NVIC_SetVector(irq, (uint32_t)&InterruptManager::static_irq_helper);
-        return pf;
+    pFunctionPointer_t add_common(void (*function)(void), IRQn_Type irq, bool front=false) {
+        return add_common(FunctionPointer(function), irq, front);
     }
 
-    pFunctionPointer_t add_common(void (*function)(void), IRQn_Type irq, bool front=false);
-    bool must_replace_vector(IRQn_Type irq);
+    pFunctionPointer_t add_common(const FunctionPointer &handler, IRQn_Type irq, bool front);
+    Chain* get_chain(IRQn_Type irq);
     int get_irq_index(IRQn_Type irq);
-    void irq_helper();
-    void add_helper(void (*function)(void), IRQn_Type irq, bool front=false);
     static void static_irq_helper();
 
-    CallChain* _chains[NVIC_NUM_VECTORS];
+    Chain* _chains[NVIC_NUM_VECTORS];
+    Chain _pool[INTERRUPT_MANAGER_CHAINS];
     static InterruptManager* _instance;
 };
 
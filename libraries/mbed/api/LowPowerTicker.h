@@ -0,0 +1,62 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LOWPOWERTICKER_H
+#define MBED_LOWPOWERTICKER_H
+
+#include "platform.h"
+
+#if DEVICE_LOWPOWERTIMER
+
+#include "Ticker.h"
+#include "lp_ticker_api.h"
+
+namespace mbed {
+
+/** A Ticker on the low power ticker, whose calls can wake the device from deepsleep()
+ *
+ *  Its resolution is that of the low power clock of the target.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * LowPowerTicker ticker;
+ * DigitalOut led(LED1);
+ *
+ * void blink() {
+ *     led = !led;
+ * }
+ *
+ * int main() {
+ *     ticker.attach(&blink, 60);
+ *     while (1) {
+ *         deepsleep();
+ *     }
+ * }
+ * @endcode
+ */
+class LowPowerTicker : public Ticker {
+
+public:
+    LowPowerTicker() : Ticker(get_lp_ticker_data()) {
+    }
+};
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -0,0 +1,62 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LOWPOWERTIMEOUT_H
+#define MBED_LOWPOWERTIMEOUT_H
+
+#include "platform.h"
+
+#if DEVICE_LOWPOWERTIMER
+
+#include "Timeout.h"
+#include "lp_ticker_api.h"
+
+namespace mbed {
+
+/** A Timeout on the low power ticker, which can wake the device from deepsleep()
+ *
+ *  Its resolution is that of the low power clock of the target.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * LowPowerTimeout timeout;
+ * volatile bool expired = false;
+ *
+ * void expire() {
+ *     expired = true;
+ * }
+ *
+ * int main() {
+ *     timeout.attach(&expire, 300);
+ *     while (!expired) {
+ *         deepsleep();
+ *     }
+ * }
+ * @endcode
+ */
+class LowPowerTimeout : public Timeout {
+
+public:
+    LowPowerTimeout() : Timeout(get_lp_ticker_data()) {
+    }
+};
+
+} // namespace mbed
+
+#endif
+
+#endif
@@ -21,6 +21,8 @@
 #if DEVICE_SPI
 
 #include "spi_api.h"
+#include "gpio_api.h"
+#include "Callback.h"
 
 namespace mbed {
 
@@ -31,6 +33,11 @@ namespace mbed {
  * Most SPI devices will also require Chip Select and Reset signals. These
  * can be controlled using <DigitalOut> pins
  *
+ * Blocks of words can also be exchanged with transfer(), which returns
+ * straight away and reports the end of the transfer to a callback. Transfers
+ * of several SPI objects sharing a bus are queued and run in order, each
+ * with the format, frequency and chip select of its own SPI object.
+ *
  * Example:
  * @code
  * // Send a byte to a SPI slave, and record the response
@@ -58,8 +65,9 @@ public:
      *  @param mosi SPI Master Out, Slave In pin
      *  @param miso SPI Master In, Slave Out pin
      *  @param sclk SPI Clock pin
+     *  @param ssel Optional chip select, driven low for the duration of each transfer()
      */
-    SPI(PinName mosi, PinName miso, PinName sclk, PinName _unused=NC);
+    SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel=NC);
 
     /** Configure the data transmission format
      *
@@ -92,10 +100,42 @@ public:
     */
     virtual int write(int value);
 
-public:
-    virtual ~SPI() {
+    typedef Callback<void(int)> event_callback_t;
+
+    /** Exchange a block of words with the SPI slave without blocking
+     *
+     *  Words are uint8_t for frames of up to 8 bits and uint16_t otherwise.
+     *  If the bus is busy with the transfer of another SPI object, the
+     *  transfer is queued and started once the bus is free. Targets without
+     *  DEVICE_SPI_ASYNCH run the transfer before returning.
+     *
+     *  @param tx_buffer Words to send, or NULL to send SPI_FILL_WORD
+     *  @param rx_buffer Buffer for the received words, or NULL to discard them
+     *  @param length Number of words to exchange
+     *  @param callback Called from interrupt context with the events that ended the transfer
+     *  @param event Mask of the SPI_EVENT_ values passed to the callback
+     *
+     *  @returns
+     *    0 if the transfer was started or queued,
+     *   -1 if this SPI object already has a transfer in progress
+     */
+    int transfer(const void *tx_buffer, void *rx_buffer, int length,
+                 const event_callback_t &callback, int event = SPI_EVENT_COMPLETE);
+
+    /** Stop the transfer in progress or remove it from the queue, without
+     *  calling its callback
+     */
+    void abort_transfer();
+
+    /** Check whether this SPI object has a transfer started or queued
+     */
+    bool transfer_pending() const {
+        return _transfer_state != TransferIdle;
     }
 
+public:
+    virtual ~SPI();
+
 protected:
     spi_t _spi;
 
@@ -104,6 +144,28 @@ protected:
     int _bits;
     int _mode;
     int _hz;
+
+    enum TransferState {
+        TransferIdle,
+        TransferQueued,
+        TransferActive
+    };
+
+    void select(int value);
+    void transfer_done(int event);
+    static void start_queued(void);
+    static void irq_handler_asynch(uint32_t id, int event);
+
+    static SPI *_transfers;
+    SPI *_transfer_next;
+    volatile TransferState _transfer_state;
+    const void *_tx_buffer;
+    void *_rx_buffer;
+    int _length;
+    event_callback_t _callback;
+    int _event;
+    PinName _ssel_pin;
+    gpio_t _ssel;
 };
 
 } // namespace mbed
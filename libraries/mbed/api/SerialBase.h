@@ -26,6 +26,8 @@
 
 namespace mbed {
 
+class Event;
+
 /** A base class for serial port implementations
  * Can't be instantiated directly (use Serial or RawSerial)
  */
@@ -98,11 +100,26 @@ public:
     template<typename T>
     void attach(T* tptr, void (T::*mptr)(void), IrqType type=RxIrq) {
         if((mptr != NULL) && (tptr != NULL)) {
+            _detach_event(type);
             _irq[type].attach(tptr, mptr);
             serial_irq_set(&_serial, (SerialIrq)type, 1);
         }
     }
 
+    /** Attach an event to post to its queue whenever a serial interrupt is generated
+     *
+     *  The interrupt is masked from the post until the event's function, run
+     *  from the thread dispatching the queue, returns: it must read the
+     *  received characters (RxIrq) or fill the transmit buffer (TxIrq).
+     *  The event's done function is taken over to unmask the interrupt, from
+     *  the dispatching thread or from Event::cancel(), so it must not be
+     *  attached elsewhere; it is cleared when the event is detached.
+     *
+     *  @param event The event to post, or 0 to set as none
+     *  @param type Which serial interrupt to attach the event to (Seriall::RxIrq for receive, TxIrq for transmit buffer empty)
+     */
+    void attach(Event *event, IrqType type=RxIrq);
+
     /** Generate a break condition on the serial line
      */
     void send_break();
@@ -127,8 +144,13 @@ protected:
     int _base_getc();
     int _base_putc(int c);
 
+    void _detach_event(IrqType type);
+    void _rx_irq_enable();
+    void _tx_irq_enable();
+
     serial_t        _serial;
     FunctionPointer _irq[2];
+    Event          *_irq_event[2];
     int             _baud;
 };
 
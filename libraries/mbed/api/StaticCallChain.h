@@ -0,0 +1,191 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_STATICCALLCHAIN_H
+#define MBED_STATICCALLCHAIN_H
+
+#include "Callback.h"
+
+namespace mbed {
+
+/** A CallChain with a fixed, inline capacity
+ *
+ *  Functions are stored as Callback<void()> objects inside the chain, so
+ *  adding and removing functions never allocates and is safe in setup paths
+ *  running with interrupts disabled.
+ *
+ * Example:
+ * @code
+ * #include "mbed.h"
+ *
+ * StaticCallChain<4> chain;
+ *
+ * void first() {
+ *     printf("'first' function.\n");
+ * }
+ *
+ * class Test {
+ * public:
+ *     void f() {
+ *         printf("A.f (class member).\n");
+ *     }
+ * };
+ *
+ * int main() {
+ *     Test test;
+ *     chain.add(first);
+ *     chain.add(&test, &Test::f);
+ *     chain.call();
+ * }
+ * @endcode
+ */
+template <int N>
+class StaticCallChain {
+public:
+    StaticCallChain() : _elements(0) {
+    }
+
+    /** Add a function at the end of the chain
+     *
+     *  @param cb The callback to add
+     *
+     *  @returns
+     *  true if the function was added, false if the chain is full
+     */
+    bool add(const Callback<void()> &cb) {
+        if (_elements >= N)
+            return false;
+        _chain[_elements++] = cb;
+        return true;
+    }
+
+    /** Add a function at the end of the chain
+     *
+     *  @param function A pointer to a void function
+     */
+    bool add(void (*function)(void)) {
+        return add(Callback<void()>(function));
+    }
+
+    /** Add a member function at the end of the chain
+     *
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    bool add(T *tptr, void (T::*mptr)(void)) {
+        return add(Callback<void()>(tptr, mptr));
+    }
+
+    /** Add a function at the beginning of the chain
+     *
+     *  @param cb The callback to add
+     *
+     *  @returns
+     *  true if the function was added, false if the chain is full
+     */
+    bool add_front(const Callback<void()> &cb) {
+        if (_elements >= N)
+            return false;
+        for (int i = _elements; i > 0; i--)
+            _chain[i] = _chain[i - 1];
+        _chain[0] = cb;
+        _elements++;
+        return true;
+    }
+
+    /** Add a function at the beginning of the chain
+     *
+     *  @param function A pointer to a void function
+     */
+    bool add_front(void (*function)(void)) {
+        return add_front(Callback<void()>(function));
+    }
+
+    /** Add a member function at the beginning of the chain
+     *
+     *  @param tptr pointer to the object to call the member function on
+     *  @param mptr pointer to the member function to be called
+     */
+    template<typename T>
+    bool add_front(T *tptr, void (T::*mptr)(void)) {
+        return add_front(Callback<void()>(tptr, mptr));
+    }
+
+    /** Get the number of functions in the chain
+     */
+    int size() const {
+        return _elements;
+    }
+
+    /** Get the maximum number of functions in the chain
+     */
+    int capacity() const {
+        return N;
+    }
+
+    /** Look for a function in the chain
+     *
+     *  @returns
+     *  The index of the function if found, -1 otherwise.
+     */
+    int find(const Callback<void()> &cb) const {
+        for (int i = 0; i < _elements; i++)
+            if (_chain[i] == cb)
+                return i;
+        return -1;
+    }
+
+    /** Remove a function from the chain
+     *
+     *  @returns
+     *  true if the function was found and removed, false otherwise.
+     */
+    bool remove(const Callback<void()> &cb) {
+        int i = find(cb);
+        if (i == -1)
+            return false;
+        for (_elements--; i < _elements; i++)
+            _chain[i] = _chain[i + 1];
+        return true;
+    }
+
+    /** Clear the chain (remove all functions in the chain).
+     */
+    void clear() {
+        _elements = 0;
+    }
+
+    /** Call all the functions in the chain in sequence
+     */
+    void call() const {
+        for (int i = 0; i < _elements; i++)
+            _chain[i].call();
+    }
+
+#ifdef MBED_OPERATORS
+    void operator ()(void) const {
+        call();
+    }
+#endif
+
+private:
+    Callback<void()> _chain[N];
+    int _elements;
+};
+
+} // namespace mbed
+
+#endif
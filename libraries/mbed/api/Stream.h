@@ -52,6 +52,9 @@ protected:
 
     /* disallow copy constructor and assignment operators */
 private:
+#ifdef MBED_MINIMAL_PRINTF
+    static int _printf_output(void *context, const char *data, int length);
+#endif
     Stream(const Stream&);
     Stream & operator = (const Stream&);
 };
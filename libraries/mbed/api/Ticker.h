@@ -19,8 +19,29 @@
 #include "TimerEvent.h"
 #include "FunctionPointer.h"
 
+/** Number of buckets of the Ticker jitter histogram */
+#ifndef MBED_TICKER_BUCKETS
+#define MBED_TICKER_BUCKETS     10
+#endif
+
 namespace mbed {
 
+class Event;
+
+/** Jitter statistics of a Ticker, see Ticker::attach_stats
+ *
+ *  The jitter is how late the function is called after its period ended.
+ *  Bucket 0 of the histogram counts the calls on time, bucket n the calls
+ *  between 2^(n-1) and 2^n - 1 micro-seconds late, the last bucket all the
+ *  later ones.
+ */
+struct TickerStats {
+    uint32_t count;         /**< calls measured */
+    uint32_t min;           /**< smallest jitter in micro-seconds */
+    uint32_t max;           /**< largest jitter in micro-seconds */
+    uint32_t histogram[MBED_TICKER_BUCKETS];
+};
+
 /** A Ticker is used to call a function at a recurring interval
  *
  *  You can use as many seperate Ticker objects as you require.
@@ -57,6 +78,25 @@ namespace mbed {
 class Ticker : public TimerEvent {
 
 public:
+    /** What the Ticker does when the function could not be called within its
+     *  period, because of a long handler or interrupts being masked
+     *
+     *  The calls stay on the grid set by attach, so they do not drift, except
+     *  with Coalesce.
+     */
+    enum OverrunPolicy {
+        CatchUp,    /**< every missed call is made, back to back (default) */
+        Skip,       /**< the missed calls are dropped, the next one is on the grid */
+        Coalesce    /**< the missed calls are dropped and the grid restarts from now */
+    };
+
+    Ticker() : _delay(0), _policy(CatchUp), _missed(0), _stats(NULL) {
+    }
+
+    /** Create a Ticker scheduled on the given ticker, the us_ticker by default
+     */
+    Ticker(const ticker_data_t *data) : TimerEvent(data), _delay(0), _policy(CatchUp), _missed(0), _stats(NULL) {
+    }
 
     /** Attach a function to be called by the Ticker, specifiying the interval in seconds
      *
@@ -83,7 +123,7 @@ public:
      *  @param fptr pointer to the function to be called
      *  @param t the time between calls in micro-seconds
      */
-    void attach_us(void (*fptr)(void), unsigned int t) {
+    void attach_us(void (*fptr)(void), us_timestamp_t t) {
         _function.attach(fptr);
         setup(t);
     }
@@ -95,21 +135,65 @@ public:
      *  @param t the time between calls in micro-seconds
      */
     template<typename T>
-    void attach_us(T* tptr, void (T::*mptr)(void), unsigned int t) {
+    void attach_us(T* tptr, void (T::*mptr)(void), us_timestamp_t t) {
         _function.attach(tptr, mptr);
         setup(t);
     }
 
+    /** Attach an event to be posted to its queue by the Ticker, specifiying the interval in seconds
+     *
+     *  The event's function then runs from the thread dispatching the queue.
+     *
+     *  @param event The event to post
+     *  @param t the time between posts in seconds
+     */
+    void attach(Event *event, float t) {
+        attach_us(event, t * 1000000.0f);
+    }
+
+    /** Attach an event to be posted to its queue by the Ticker, specifiying the interval in micro-seconds
+     *
+     *  @param event The event to post
+     *  @param t the time between posts in micro-seconds
+     */
+    void attach_us(Event *event, us_timestamp_t t);
+
     /** Detach the function
      */
     void detach();
 
+    /** Set what to do with the calls missed because of overruns
+     *
+     *  @param policy CatchUp, Skip or Coalesce
+     */
+    void set_overrun_policy(OverrunPolicy policy) {
+        _policy = policy;
+    }
+
+    /** Get the number of periods missed since the function was attached
+     *
+     *  With CatchUp these are the calls made a whole period or more late,
+     *  with Skip and Coalesce the periods that got no call.
+     */
+    uint32_t missed_periods() const {
+        return _missed;
+    }
+
+    /** Collect the jitter of the calls into stats, which is cleared first
+     *
+     *  @param stats the statistics to update from the Ticker interrupt, or NULL to stop
+     */
+    void attach_stats(TickerStats *stats);
+
 protected:
-    void setup(unsigned int t);
+    void setup(us_timestamp_t t);
     virtual void handler();
 
-    unsigned int _delay;
+    us_timestamp_t _delay;
     FunctionPointer _function;
+    OverrunPolicy _policy;
+    uint32_t _missed;
+    TickerStats *_stats;
 };
 
 } // namespace mbed
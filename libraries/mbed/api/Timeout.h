@@ -50,6 +50,15 @@ namespace mbed {
  */
 class Timeout : public Ticker {
 
+public:
+    Timeout() : Ticker() {
+    }
+
+    /** Create a Timeout on another ticker than the us_ticker
+     */
+    Timeout(const ticker_data_t *data) : Ticker(data) {
+    }
+
 protected:
     virtual void handler();
 };
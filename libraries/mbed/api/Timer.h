@@ -17,6 +17,7 @@
 #define MBED_TIMER_H
 
 #include "platform.h"
+#include "us_ticker_api.h"
 
 namespace mbed {
 
@@ -46,6 +47,10 @@ class Timer {
 public:
     Timer();
 
+    /** Create a Timer reading another ticker than the us_ticker
+     */
+    Timer(const ticker_data_t *data);
+
     /** Start the timer
      */
     void start();
@@ -72,15 +77,20 @@ public:
      */
     int read_us();
 
+    /** Get the time passed in micro-seconds, on the 64 bit timebase
+     */
+    us_timestamp_t read_high_resolution_us();
+
 #ifdef MBED_OPERATORS
     operator float();
 #endif
 
 protected:
-    int slicetime();
+    us_timestamp_t slicetime();
     int _running;          // whether the timer is running
-    unsigned int _start;   // the start time of the latest slice
-    int _time;             // any accumulated time from previous slices
+    us_timestamp_t _start; // the start time of the latest slice
+    us_timestamp_t _time;  // any accumulated time from previous slices
+    const ticker_data_t *_ticker_data;
 };
 
 } // namespace mbed
@@ -26,6 +26,10 @@ class TimerEvent {
 public:
     TimerEvent();
 
+    /** Create a TimerEvent queued on the given ticker
+     */
+    TimerEvent(const ticker_data_t *data);
+
     /** The handler registered with the underlying timer interrupt
      */
     static void irq(uint32_t id);
@@ -38,13 +42,23 @@ protected:
     // The handler called to service the timer event of the derived class
     virtual void handler() = 0;
 
-    // insert in to linked list
+    // insert in to the event queue
     void insert(unsigned int timestamp);
 
-    // remove from linked list, if in it
+    // insert in to the event queue, with a timestamp on the 64 bit timebase
+    void insert_absolute(us_timestamp_t timestamp);
+
+    // remove from the event queue, if in it
     void remove();
 
     ticker_event_t event;
+
+    us_timestamp_t _target;  // 64 bit timestamp of the event set by insert_absolute
+    bool _long_wait;         // the queued event is only an intermediate step towards _target
+    const ticker_data_t *_ticker_data;
+
+private:
+    void schedule();
 };
 
 } // namespace mbed
@@ -0,0 +1,95 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_CRITICAL_H
+#define MBED_CRITICAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Check whether interrupts are enabled on the core
+ *
+ *  @returns true if interrupts are enabled, false otherwise
+ */
+bool core_util_are_interrupts_enabled(void);
+
+/** Mark the start of a critical section
+ *
+ *  Interrupts are disabled until the matching core_util_critical_section_exit().
+ *  Sections nest: only the exit of the outermost one enables interrupts again,
+ *  and only if they were enabled when it was entered. This makes it safe to
+ *  call from interrupt handlers and from code that already disabled interrupts.
+ */
+void core_util_critical_section_enter(void);
+
+/** Mark the end of a critical section
+ */
+void core_util_critical_section_exit(void);
+
+#ifdef MBED_CRITICAL_TRACE
+
+/* With MBED_CRITICAL_TRACE defined, the time interrupts stay disabled by each
+   outermost critical section is measured with the mbed_profile.h time base
+   (MBED_PROFILE_UNIT) and recorded with the address of the code that entered
+   it. Sections entered while interrupts were already disabled are not timed. */
+
+/** Number of intervals kept in the trace ring buffer */
+#ifndef MBED_CRITICAL_TRACE_SIZE
+#define MBED_CRITICAL_TRACE_SIZE    8
+#endif
+
+typedef struct {
+    void *caller;       /* return address of core_util_critical_section_enter() */
+    uint32_t duration;  /* time interrupts were disabled */
+} core_util_critical_trace_t;
+
+/** Set which intervals go into the ring buffer
+ *
+ *  @param duration Record every interval longer than this. With 0, the
+ *                  default, only intervals longer than all earlier ones are
+ *                  recorded so the ring keeps the longest ones.
+ */
+void core_util_critical_trace_threshold(uint32_t duration);
+
+/** Longest interval since the last reset
+ *
+ *  @param caller If not NULL, set to the caller of that interval
+ *  @returns The duration of the interval, 0 if none was recorded
+ */
+uint32_t core_util_critical_trace_max(void **caller);
+
+/** Copy the recorded intervals, newest first
+ *
+ *  @param entries Array receiving the intervals
+ *  @param count Size of the array
+ *  @returns The number of intervals copied
+ */
+int core_util_critical_trace_read(core_util_critical_trace_t *entries, int count);
+
+/** Clear the maximum and the ring buffer
+ */
+void core_util_critical_trace_reset(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -32,6 +32,7 @@
 #include "DigitalIn.h"
 #include "DigitalOut.h"
 #include "DigitalInOut.h"
+#include "FastIO.h"
 #include "BusIn.h"
 #include "BusOut.h"
 #include "BusInOut.h"
@@ -39,6 +40,7 @@
 #include "PortInOut.h"
 #include "PortOut.h"
 #include "AnalogIn.h"
+#include "AnalogInStream.h"
 #include "AnalogOut.h"
 #include "PwmOut.h"
 #include "Serial.h"
@@ -49,13 +51,20 @@
 #include "Ethernet.h"
 #include "CAN.h"
 #include "RawSerial.h"
+#include "BufferedSerial.h"
 
 // mbed Internal components
 #include "Timer.h"
 #include "Ticker.h"
 #include "Timeout.h"
+#include "LowPowerTicker.h"
+#include "LowPowerTimeout.h"
+#include "LowPowerTimer.h"
 #include "LocalFileSystem.h"
 #include "InterruptIn.h"
+#include "Callback.h"
+#include "StaticCallChain.h"
+#include "EventQueue.h"
 #include "wait_api.h"
 #include "sleep_api.h"
 #include "rtc_time.h"
@@ -0,0 +1,100 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_ALLOC_H
+#define MBED_ALLOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Two level segregated fit (TLSF) heap
+ *
+ * malloc() and free() take constant time whatever the state of the heap:
+ * the free blocks are kept in lists by size class, found through two
+ * levels of bitmaps, and merged with their neighbours when freed. A
+ * request is served from a class that is guaranteed to fit, so it is
+ * never searched for.
+ *
+ * With MBED_HEAP_TLSF defined, malloc(), free(), realloc(), calloc() and
+ * the C++ new and delete operators use this heap. The heap starts with a
+ * static pool of MBED_HEAP_SIZE bytes; with the GCC toolchains it also
+ * grows through _sbrk() into the rest of the RAM.
+ */
+
+/** Size of the static pool */
+#ifndef MBED_HEAP_SIZE
+#define MBED_HEAP_SIZE          4096
+#endif
+
+/** Smallest amount taken from _sbrk() when the heap grows */
+#ifndef MBED_HEAP_GROW_SIZE
+#define MBED_HEAP_GROW_SIZE     1024
+#endif
+
+/** Number of lists per power of two, as a log2. More lists waste less
+ *  memory rounding requests up, at the cost of a larger table. */
+#ifndef MBED_HEAP_SL_LOG2
+#define MBED_HEAP_SL_LOG2       3
+#endif
+
+/** Log2 of the largest block, larger pools are split */
+#ifndef MBED_HEAP_FL_MAX
+#define MBED_HEAP_FL_MAX        20
+#endif
+
+typedef struct {
+    size_t heap_size;           /* bytes in the pools, headers included */
+    size_t free_size;           /* bytes in the free blocks */
+    size_t largest_free_size;   /* largest allocation that would succeed now */
+    size_t allocated_size;      /* bytes in the allocated blocks */
+    size_t max_allocated_size;  /* high-water mark of allocated_size */
+    uint32_t alloc_count;       /* blocks allocated now */
+    uint32_t alloc_fail_count;  /* requests that could not be served */
+} mbed_alloc_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void *mbed_alloc_malloc(size_t size);
+void mbed_alloc_free(void *ptr);
+void *mbed_alloc_realloc(void *ptr, size_t size);
+void *mbed_alloc_calloc(size_t count, size_t size);
+
+/** Give a block of memory to the heap
+ *
+ *  @returns 0 on success, -1 if the block is too small
+ */
+int mbed_alloc_add_pool(void *start, size_t size);
+
+/** Read the heap statistics
+ *
+ *  Everything is constant time but largest_free_size, which walks one
+ *  free list.
+ */
+void mbed_alloc_get_stats(mbed_alloc_stats_t *stats);
+
+/** Serialise the heap, weak hooks doing nothing
+ *
+ *  The rtos library makes them take a mutex.
+ */
+void mbed_alloc_lock(void);
+void mbed_alloc_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
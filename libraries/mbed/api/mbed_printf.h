@@ -0,0 +1,83 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_PRINTF_H
+#define MBED_PRINTF_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/* Compact printf engine
+ *
+ * Formats without using the heap, with a bounded stack and no shared
+ * state, so it can be called from several threads or from interrupt
+ * handlers. The output is produced in chunks of MBED_PRINTF_CHUNK
+ * characters rather than one character at a time.
+ *
+ * Supported: the flags - + space # 0, width and precision (also as *),
+ * the length modifiers hh h l ll j z t L and the conversions
+ * d i u o x X c s p % as well as f F e E g G. Floating point values are
+ * printed with at most 9 decimals and the last digit is rounded half up,
+ * so it can differ from the C library for values like 2.5. With f and F,
+ * values of 2^64 and more print their first 17 significant digits and
+ * zeros for the following ones. Defining MBED_PRINTF_INTEGER_ONLY
+ * removes floating point support, which saves the soft float code on
+ * cores without an FPU; the floating point conversions then print their
+ * format specification. %n is not supported.
+ */
+
+/** Characters formatted before they are passed on */
+#ifndef MBED_PRINTF_CHUNK
+#define MBED_PRINTF_CHUNK   32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Receives the formatted text
+ *
+ *  @returns A negative value on error, which drops the rest of the output
+ */
+typedef int (*mbed_printf_output)(void *context, const char *data, int length);
+
+/** Format to an output function
+ *
+ *  @returns The number of characters formatted, negative if output failed
+ */
+int mbed_vxprintf(mbed_printf_output output, void *context, const char *format, va_list arg);
+int mbed_xprintf(mbed_printf_output output, void *context, const char *format, ...);
+
+/** Format into a buffer, as snprintf()
+ *
+ *  @returns The length of the whole formatted text, which was truncated
+ *           if it is not less than size
+ */
+int mbed_vsnprintf(char *buffer, size_t size, const char *format, va_list arg);
+int mbed_snprintf(char *buffer, size_t size, const char *format, ...);
+
+/** Format to stdout
+ *
+ *  The chunks are passed to fwrite(), so the output stays in order with
+ *  the rest of stdio.
+ */
+int mbed_vprintf(const char *format, va_list arg);
+int mbed_printf(const char *format, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
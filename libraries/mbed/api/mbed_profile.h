@@ -0,0 +1,146 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_PROFILE_H
+#define MBED_PROFILE_H
+
+#include <stdint.h>
+#include "cmsis.h"
+
+/** Number of call sites that can be profiled */
+#ifndef MBED_PROFILE_SITES
+#define MBED_PROFILE_SITES      16
+#endif
+
+/** Bucket n of the histogram counts the durations in [2^n, 2^(n+1)) */
+#define MBED_PROFILE_BUCKETS    32
+
+/* Time base: the DWT cycle counter on Cortex-M3/M4, the us ticker on
+   cores without it and clock_gettime() when built for the host */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+#define MBED_PROFILE_UNIT       "cycles"
+#elif defined(__CORTEX_M)
+#include "us_ticker_api.h"
+#define MBED_PROFILE_UNIT       "us"
+#else
+#define MBED_PROFILE_UNIT       "ns"
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[MBED_PROFILE_BUCKETS];
+} mbed_profile_site_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Read the profiling time base */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+static inline uint32_t mbed_profile_now(void) {
+    return DWT->CYCCNT;
+}
+#elif defined(__CORTEX_M)
+static inline uint32_t mbed_profile_now(void) {
+    return us_ticker_read();
+}
+#else
+uint32_t mbed_profile_now(void);
+#endif
+
+/** Start the time base, called on the first mbed_profile_start() */
+void mbed_profile_init(void);
+
+/** Register the call site on first use and return the start time
+ *
+ *  @param site Index of the site, -1 until registered. Stays -1 when the table is full.
+ *  @param name Name printed by mbed_profile_dump()
+ */
+uint32_t mbed_profile_start(int *site, const char *name);
+
+/** Add one duration to the statistics of a site */
+void mbed_profile_record(int site, uint32_t elapsed);
+
+/** Number of registered sites */
+int mbed_profile_count(void);
+
+/** Statistics of a registered site, NULL if there is no such site */
+const mbed_profile_site_t *mbed_profile_get(int site);
+
+/** Clear the statistics of all sites, keeping them registered */
+void mbed_profile_reset(void);
+
+/** Print the statistics and histograms of all sites on stdout */
+void mbed_profile_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* The instrumentation compiles to nothing unless MBED_PROFILE is defined.
+ *
+ *   MBED_PROFILE_START(name) ... MBED_PROFILE_STOP(name)
+ *     time the code between them, START declares variables so it has to be
+ *     placed where a declaration is allowed
+ *
+ *   MBED_PROFILE_SCOPE(name)
+ *     (C++ only) time the rest of the enclosing scope
+ */
+#ifdef MBED_PROFILE
+
+#define MBED_PROFILE_START(name) \
+    static int name##_profile_site = -1; \
+    uint32_t name##_profile_start = mbed_profile_start(&name##_profile_site, #name)
+
+#define MBED_PROFILE_STOP(name) \
+    mbed_profile_record(name##_profile_site, mbed_profile_now() - name##_profile_start)
+
+#ifdef __cplusplus
+namespace mbed {
+
+class ProfileScope {
+public:
+    ProfileScope(int *site, const char *name) : _site(site), _start(mbed_profile_start(site, name)) {
+    }
+
+    ~ProfileScope() {
+        mbed_profile_record(*_site, mbed_profile_now() - _start);
+    }
+
+private:
+    int *_site;
+    uint32_t _start;
+};
+
+} // namespace mbed
+
+#define MBED_PROFILE_SCOPE(name) \
+    static int name##_profile_site = -1; \
+    mbed::ProfileScope name##_profile_scope(&name##_profile_site, #name)
+#endif
+
+#else
+
+#define MBED_PROFILE_START(name)
+#define MBED_PROFILE_STOP(name)
+#define MBED_PROFILE_SCOPE(name)
+
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_RETARGET_H
+#define MBED_RETARGET_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/** Number of files that can be open at the same time, besides stdin,
+ *  stdout and stderr
+ */
+#ifndef MBED_OPEN_MAX
+#define MBED_OPEN_MAX           16
+#endif
+
+/** mbed_fwrite() writes blocks of at least this many bytes directly */
+#ifndef MBED_FWRITE_DIRECT_MIN
+#define MBED_FWRITE_DIRECT_MIN  512
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Descriptor locks
+ *
+ *  Calls on a descriptor are serialized by its own lock, so threads using
+ *  different files never wait for each other. The default implementations
+ *  do nothing; an RTOS provides them (the rtos library uses one mutex per
+ *  descriptor). fd is in the range 0 to MBED_OPEN_MAX - 1, and
+ *  mbed_filehandle_lock_init() is called from _open before the first use
+ *  of a descriptor.
+ */
+void mbed_filehandle_lock_init(int fd);
+void mbed_filehandle_lock(int fd);
+void mbed_filehandle_unlock(int fd);
+
+/** Write to a stream, bypassing the C library buffer for large blocks
+ *
+ *  Blocks of at least MBED_FWRITE_DIRECT_MIN bytes written to a file that
+ *  is not a terminal are passed straight to FileHandle::write() after
+ *  flushing what the stream already buffered, instead of being copied
+ *  through the buffer. Anything else goes to fwrite().
+ *
+ *  @returns The number of complete elements written, as fwrite()
+ */
+size_t mbed_fwrite(const void *ptr, size_t size, size_t count, FILE *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AnalogInStream.h"
+
+#if DEVICE_ANALOGIN_STREAM
+
+namespace mbed {
+
+AnalogInStream *AnalogInStream::_instance = NULL;
+
+AnalogInStream::AnalogInStream(PinName pin0, PinName pin1, PinName pin2, PinName pin3) :
+        _count(0), _buffer(NULL), _half_bytes(0), _half_length(0) {
+    PinName pins[4] = {pin0, pin1, pin2, pin3};
+    for (int i = 0; (i < 4) && (pins[i] != NC); i++) {
+        analogin_init(&_channels[_count++], pins[i]);
+    }
+}
+
+AnalogInStream::~AnalogInStream() {
+    stop();
+}
+
+int AnalogInStream::start(uint32_t rate, void *buffer, int length, const block_callback_t &callback,
+                          AnalogInFormat format) {
+    stop();
+
+    int size = (format == AnalogInFormatF32) ? sizeof(float) : sizeof(uint16_t);
+    _buffer = (char*)buffer;
+    _half_length = length / 2;
+    _half_bytes = _half_length * size;
+    _callback = callback;
+
+    // claim the HAL stream, stopping whichever stream held it
+    if (_instance != NULL) {
+        _instance->stop();
+    }
+    _instance = this;
+    if (analogin_stream_start(_channels, _count, rate, buffer, length, format,
+                              &AnalogInStream::_irq_handler, (uint32_t)this) != 0) {
+        _instance = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+void AnalogInStream::stop() {
+    if (_instance == this) {
+        analogin_stream_stop();
+        _instance = NULL;
+    }
+}
+
+void AnalogInStream::_irq_handler(uint32_t id, int half) {
+    AnalogInStream *handler = (AnalogInStream*)id;
+    handler->_callback.call(handler->_buffer + half * handler->_half_bytes, handler->_half_length);
+}
+
+} // namespace mbed
+
+#endif
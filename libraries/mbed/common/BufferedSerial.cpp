@@ -0,0 +1,194 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BufferedSerial.h"
+#include "cmsis.h"
+#include "critical.h"
+#include <string.h>
+
+#if DEVICE_SERIAL
+
+namespace mbed {
+
+// Targets without serial_write_block/serial_read_block move one character
+// per FIFO status check
+static int write_block(serial_t *obj, const char *data, int length) {
+#if DEVICE_SERIAL_BLOCK
+    return serial_write_block(obj, data, length);
+#else
+    int written = 0;
+    while ((written < length) && serial_writable(obj)) {
+        serial_putc(obj, data[written++]);
+    }
+    return written;
+#endif
+}
+
+static int read_block(serial_t *obj, char *data, int length, int *overrun) {
+#if DEVICE_SERIAL_BLOCK
+    return serial_read_block(obj, data, length, overrun);
+#else
+    int count = 0;
+    *overrun = 0;
+    while ((count < length) && serial_readable(obj)) {
+        data[count++] = serial_getc(obj);
+    }
+    return count;
+#endif
+}
+
+BufferedSerial::BufferedSerial(PinName tx, PinName rx, int tx_size, int rx_size, const char *name) :
+        SerialBase(tx, rx), Stream(name),
+        _tx_buf(new char[tx_size]), _tx_size(tx_size), _tx_head(0), _tx_tail(0), _tx_busy(false),
+        _rx_buf(new char[rx_size]), _rx_size(rx_size), _rx_head(0), _rx_tail(0),
+        _rx_overruns(0), _rx_dropped(0) {
+    _irq[RxIrq].attach(this, &BufferedSerial::rx_irq);
+    _irq[TxIrq].attach(this, &BufferedSerial::tx_irq);
+    serial_irq_set(&_serial, (SerialIrq)RxIrq, 1);
+}
+
+BufferedSerial::~BufferedSerial() {
+    serial_irq_set(&_serial, (SerialIrq)RxIrq, 0);
+    serial_irq_set(&_serial, (SerialIrq)TxIrq, 0);
+    delete[] _tx_buf;
+    delete[] _rx_buf;
+}
+
+ssize_t BufferedSerial::write(const void *buffer, size_t length) {
+    const char *data = (const char*)buffer;
+    size_t written = 0;
+
+    while (written < length) {
+        int head = _tx_head;
+        int tail = _tx_tail;
+        // contiguous free space, one slot is kept empty to tell full from empty
+        int space = (tail > head) ? (tail - head - 1) : (_tx_size - head - (tail == 0 ? 1 : 0));
+        if (space == 0) {
+            tx_start();
+            continue;
+        }
+        if (space > (int)(length - written))
+            space = length - written;
+        memcpy(_tx_buf + head, data + written, space);
+        head += space;
+        _tx_head = (head == _tx_size) ? 0 : head;
+        written += space;
+    }
+    tx_start();
+    return written;
+}
+
+ssize_t BufferedSerial::read(void *buffer, size_t length) {
+    char *data = (char*)buffer;
+    size_t count = 0;
+
+    if (length == 0)
+        return 0;
+    while (_rx_head == _rx_tail);
+
+    while (count < length) {
+        int head = _rx_head;
+        int tail = _rx_tail;
+        int available = (head >= tail) ? (head - tail) : (_rx_size - tail);
+        if (available == 0)
+            break;
+        if (available > (int)(length - count))
+            available = length - count;
+        memcpy(data + count, _rx_buf + tail, available);
+        tail += available;
+        _rx_tail = (tail == _rx_size) ? 0 : tail;
+        count += available;
+    }
+    return count;
+}
+
+int BufferedSerial::_getc() {
+    char c;
+    read(&c, 1);
+    return (unsigned char)c;
+}
+
+int BufferedSerial::_putc(int c) {
+    char ch = c;
+    write(&ch, 1);
+    return c;
+}
+
+int BufferedSerial::fsync() {
+    while (_tx_busy);
+    return 0;
+}
+
+// Move characters from the transmit buffer into the UART until either is
+// exhausted
+void BufferedSerial::tx_fill() {
+    while (_tx_tail != _tx_head) {
+        int tail = _tx_tail;
+        int head = _tx_head;
+        int chunk = ((head > tail) ? head : _tx_size) - tail;
+        int n = write_block(&_serial, _tx_buf + tail, chunk);
+        tail += n;
+        _tx_tail = (tail == _tx_size) ? 0 : tail;
+        if (n < chunk)
+            break;
+    }
+}
+
+void BufferedSerial::tx_start() {
+    core_util_critical_section_enter();
+    if (!_tx_busy && (_tx_tail != _tx_head)) {
+        tx_fill();
+        _tx_busy = true;
+        serial_irq_set(&_serial, (SerialIrq)TxIrq, 1);
+    }
+    core_util_critical_section_exit();
+}
+
+void BufferedSerial::tx_irq() {
+    tx_fill();
+    if (_tx_tail == _tx_head) {
+        serial_irq_set(&_serial, (SerialIrq)TxIrq, 0);
+        _tx_busy = false;
+    }
+}
+
+void BufferedSerial::rx_irq() {
+    int overrun;
+    while (1) {
+        int head = _rx_head;
+        int tail = _rx_tail;
+        int space = (tail > head) ? (tail - head - 1) : (_rx_size - head - (tail == 0 ? 1 : 0));
+        if (space == 0) {
+            // the buffer is full, drain the UART so the interrupt clears
+            char discard[16];
+            int n = read_block(&_serial, discard, sizeof(discard), &overrun);
+            _rx_overruns += overrun;
+            _rx_dropped += n;
+            if (n == 0)
+                break;
+            continue;
+        }
+        int n = read_block(&_serial, _rx_buf + head, space, &overrun);
+        _rx_overruns += overrun;
+        head += n;
+        _rx_head = (head == _rx_size) ? 0 : head;
+        if (n < space)
+            break;
+    }
+}
+
+} // namespace mbed
+
+#endif
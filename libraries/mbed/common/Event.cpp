@@ -0,0 +1,78 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Event.h"
+#include "EventQueue.h"
+
+namespace mbed {
+
+Event::Event(EventQueue *queue, void (*fptr)(void)) {
+    init(queue);
+    _function.attach(fptr);
+}
+
+void Event::init(EventQueue *queue) {
+    _queue = queue;
+    _period = 0;
+    _next = NULL;
+    _pending = 0;
+    _posted = 0;
+    reset_stats();
+}
+
+Event::~Event() {
+    cancel();
+}
+
+void Event::post() {
+    _queue->post(this);
+}
+
+void Event::post_in(us_timestamp_t us) {
+    remove();
+    _period = 0;
+    insert_absolute(us_ticker_read64() + us);
+}
+
+void Event::post_every(us_timestamp_t us) {
+    remove();
+    _period = us;
+    insert_absolute(us_ticker_read64() + us);
+}
+
+void Event::cancel() {
+    remove();
+    _period = 0;
+    if (_queue->unlink(this)) {
+        _done.call();
+    }
+}
+
+void Event::reset_stats() {
+    _count = 0;
+    _missed = 0;
+    _latency_min = 0;
+    _latency_max = 0;
+    _latency_total = 0;
+}
+
+void Event::handler() {
+    if (_period) {
+        insert_absolute(_target + _period);
+    }
+    _queue->post(this);
+}
+
+} // namespace mbed
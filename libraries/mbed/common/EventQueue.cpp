@@ -0,0 +1,192 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "EventQueue.h"
+#include "us_ticker_api.h"
+#include "cmsis.h"
+#include "critical.h"
+
+namespace mbed {
+
+/* Compare and swap used to push on the pending list without masking interrupts
+   where the core has exclusive accesses, interrupts are masked otherwise */
+static bool compare_and_swap(void *volatile *ptr, void *expected, void *desired) {
+#if (__CORTEX_M >= 0x03)
+    do {
+        if ((void*)__LDREXW((volatile uint32_t*)ptr) != expected) {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW((uint32_t)desired, (volatile uint32_t*)ptr));
+    return true;
+#else
+    bool swapped = false;
+    core_util_critical_section_enter();
+    if (*ptr == expected) {
+        *ptr = desired;
+        swapped = true;
+    }
+    core_util_critical_section_exit();
+    return swapped;
+#endif
+}
+
+// Set a flag, returning its previous value
+static uint32_t test_and_set(volatile uint32_t *flag) {
+#if (__CORTEX_M >= 0x03)
+    uint32_t previous;
+    do {
+        previous = __LDREXW(flag);
+    } while (__STREXW(1, flag));
+    return previous;
+#else
+    core_util_critical_section_enter();
+    uint32_t previous = *flag;
+    *flag = 1;
+    core_util_critical_section_exit();
+    return previous;
+#endif
+}
+
+EventQueue::EventQueue() : _head(NULL), _ready(NULL), _ready_tail(NULL), _notify(), _latency_max(0) {
+}
+
+bool EventQueue::post(Event *event) {
+    if (test_and_set(&event->_pending)) {
+        event->_missed++;
+        return false;
+    }
+    event->_posted = us_ticker_read();
+
+    Event *head;
+    do {
+        head = _head;
+        event->_next = head;
+    } while (!compare_and_swap((void *volatile *)&_head, head, event));
+
+    _notify.call();
+    return true;
+}
+
+// Remove a pending event from the queue, returns false if it was not pending
+bool EventQueue::unlink(Event *event) {
+    bool found = false;
+    core_util_critical_section_enter();
+    for (Event *volatile *link = &_head; *link != NULL; link = &(*link)->_next) {
+        if (*link == event) {
+            *link = event->_next;
+            found = true;
+            break;
+        }
+    }
+    Event *previous = NULL;
+    for (Event *it = _ready; !found && (it != NULL); previous = it, it = it->_next) {
+        if (it == event) {
+            if (previous == NULL) {
+                _ready = event->_next;
+            } else {
+                previous->_next = event->_next;
+            }
+            if (_ready_tail == event) {
+                _ready_tail = previous;
+            }
+            found = true;
+        }
+    }
+    if (found) {
+        event->_pending = 0;
+    }
+    core_util_critical_section_exit();
+    return found;
+}
+
+int EventQueue::dispatch_pending() {
+    // take the whole pending list at once, restoring the posting order: the
+    // events stay reachable from the queue until they run, so they can be
+    // cancelled or destroyed meanwhile
+    core_util_critical_section_enter();
+    Event *list = _head;
+    _head = NULL;
+    Event *ordered = NULL;
+    Event *last = list;
+    while (list != NULL) {
+        Event *next = list->_next;
+        list->_next = ordered;
+        ordered = list;
+        list = next;
+    }
+    if (ordered != NULL) {
+        if (_ready_tail == NULL) {
+            _ready = ordered;
+        } else {
+            _ready_tail->_next = ordered;
+        }
+        _ready_tail = last;
+    }
+    core_util_critical_section_exit();
+
+    int count = 0;
+    while (true) {
+        core_util_critical_section_enter();
+        Event *event = _ready;
+        if (event != NULL) {
+            _ready = event->_next;
+            if (_ready == NULL) {
+                _ready_tail = NULL;
+            }
+            // the event can be posted again from here on, even while it runs
+            event->_pending = 0;
+        }
+        core_util_critical_section_exit();
+        if (event == NULL) {
+            break;
+        }
+
+        uint32_t latency = us_ticker_read() - event->_posted;
+        if (latency < event->_latency_min || event->_count == 0) {
+            event->_latency_min = latency;
+        }
+        if (latency > event->_latency_max) {
+            event->_latency_max = latency;
+        }
+        if (latency > _latency_max) {
+            _latency_max = latency;
+        }
+        event->_latency_total += latency;
+        event->_count++;
+
+        event->_function.call();
+        event->_done.call();
+        count++;
+    }
+    return count;
+}
+
+void EventQueue::dispatch(int ms) {
+    uint32_t start = us_ticker_read();
+    while ((ms < 0) || ((us_ticker_read() - start) < (uint32_t)ms * 1000)) {
+        if (dispatch_pending() == 0) {
+            // a post between the check and the sleep must still wake it up:
+            // a pending interrupt ends __WFI() even while it is masked
+            __disable_irq();
+            if (_head == NULL) {
+                __WFI();
+            }
+            __enable_irq();
+        }
+    }
+}
+
+} // namespace mbed
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "I2C.h"
+#include "cmsis.h"
+#include "critical.h"
 
 #if DEVICE_I2C
 
@@ -48,6 +50,10 @@ void I2C::aquire() {
 
 // write - Master Transmitter Mode
 int I2C::write(int address, const char* data, int length, bool repeated) {
+#if DEVICE_I2C_ASYNCH
+    // let a queued transaction in progress on the same bus finish first
+    while (i2c_active(&_i2c));
+#endif
     aquire();
 
     int stop = (repeated) ? 0 : 1;
@@ -62,6 +68,10 @@ int I2C::write(int data) {
 
 // read - Master Reciever Mode
 int I2C::read(int address, char* data, int length, bool repeated) {
+#if DEVICE_I2C_ASYNCH
+    // let a queued transaction in progress on the same bus finish first
+    while (i2c_active(&_i2c));
+#endif
     aquire();
 
     int stop = (repeated) ? 0 : 1;
@@ -86,6 +96,124 @@ void I2C::stop(void) {
     i2c_stop(&_i2c);
 }
 
+#define TRANSACTION_IDLE    0
+#define TRANSACTION_QUEUED  1
+#define TRANSACTION_ACTIVE  2
+
+#if DEVICE_I2C_ASYNCH
+
+I2C::Transaction *I2C::_transactions = NULL;
+
+int I2C::transfer(Transaction *transaction) {
+    if (transaction->_state != TRANSACTION_IDLE)
+        return -1;
+    transaction->_i2c = this;
+
+    // transactions are started in the order they were queued
+    core_util_critical_section_enter();
+    Transaction **tail = &_transactions;
+    while (*tail != NULL)
+        tail = &(*tail)->_next;
+    transaction->_next = NULL;
+    *tail = transaction;
+    transaction->_state = TRANSACTION_QUEUED;
+    core_util_critical_section_exit();
+
+    start_queued();
+    return 0;
+}
+
+void I2C::abort_transfer(Transaction *transaction) {
+    core_util_critical_section_enter();
+    if (transaction->_state == TRANSACTION_ACTIVE)
+        i2c_abort_asynch(&transaction->_i2c->_i2c);
+    if (transaction->_state != TRANSACTION_IDLE)
+        remove(transaction);
+    core_util_critical_section_exit();
+
+    start_queued();
+}
+
+void I2C::remove(Transaction *transaction) {
+    Transaction **p = &_transactions;
+    while (*p != transaction)
+        p = &(*p)->_next;
+    *p = transaction->_next;
+    transaction->_state = TRANSACTION_IDLE;
+}
+
+// Start the first queued transaction of every idle bus. A bus is busy from
+// the moment its first transaction is started, so later entries for the
+// same bus stay queued.
+void I2C::start_queued() {
+    core_util_critical_section_enter();
+    for (Transaction *t = _transactions; t != NULL; t = t->_next) {
+        if ((t->_state == TRANSACTION_QUEUED) && !i2c_active(&t->_i2c->_i2c)) {
+            t->_state = TRANSACTION_ACTIVE;
+            t->_i2c->aquire();
+            i2c_transfer_asynch(&t->_i2c->_i2c, t->address, t->tx_buffer, t->tx_length,
+                                t->rx_buffer, t->rx_length, &I2C::irq_handler_asynch, (uint32_t)t);
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+void I2C::irq_handler_asynch(uint32_t id, int event) {
+    Transaction *t = (Transaction*)id;
+    remove(t);
+
+    // the bus is idle while the callback runs, so it may use the blocking
+    // calls or queue the transaction again
+    if ((event & t->event) && t->callback.attached())
+        t->callback.call(event & t->event);
+
+    start_queued();
+}
+
+#else
+
+int I2C::transfer(Transaction *transaction) {
+    if (transaction->_state != TRANSACTION_IDLE)
+        return -1;
+    transaction->_state = TRANSACTION_ACTIVE;
+    transaction->_i2c = this;
+
+    int event = I2C_EVENT_COMPLETE;
+    bool repeated = transaction->rx_length > 0;
+    if (transaction->tx_length > 0 || !repeated) {
+        aquire();
+        int written = i2c_write(&_i2c, transaction->address, transaction->tx_buffer,
+                                transaction->tx_length, repeated ? 0 : 1);
+        if (written == I2C_ERROR_NO_SLAVE) {
+            event = I2C_EVENT_ERROR_NO_SLAVE;
+        } else if (written < 0) {
+            event = I2C_EVENT_ERROR;
+        } else if (written != transaction->tx_length) {
+            event = I2C_EVENT_TRANSFER_EARLY_NACK;
+        }
+    }
+    if (event == I2C_EVENT_COMPLETE && repeated) {
+        aquire();
+        int read = i2c_read(&_i2c, transaction->address, transaction->rx_buffer,
+                            transaction->rx_length, 1);
+        if (read == I2C_ERROR_NO_SLAVE) {
+            event = I2C_EVENT_ERROR_NO_SLAVE;
+        } else if (read != transaction->rx_length) {
+            event = I2C_EVENT_ERROR;
+        }
+    }
+
+    transaction->_state = TRANSACTION_IDLE;
+    if ((event & transaction->event) && transaction->callback.attached())
+        transaction->callback.call(event & transaction->event);
+    return 0;
+}
+
+void I2C::abort_transfer(Transaction *transaction) {
+}
+
+#endif
+
 } // namespace mbed
 
 #endif
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "InterruptIn.h"
+#include "Event.h"
 
 #if DEVICE_INTERRUPTIN
 
@@ -57,6 +58,22 @@ void InterruptIn::fall(void (*fptr)(void)) {
     }
 }
 
+void InterruptIn::rise(Event *event) {
+    if (event) {
+        rise(event, &Event::post);
+    } else {
+        gpio_irq_set(&gpio_irq, IRQ_RISE, 0);
+    }
+}
+
+void InterruptIn::fall(Event *event) {
+    if (event) {
+        fall(event, &Event::post);
+    } else {
+        gpio_irq_set(&gpio_irq, IRQ_FALL, 0);
+    }
+}
+
 void InterruptIn::_irq_handler(uint32_t id, gpio_irq_event event) {
     InterruptIn *handler = (InterruptIn*)id;
     switch (event) {
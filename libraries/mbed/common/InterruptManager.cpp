@@ -1,8 +1,7 @@
 #include "InterruptManager.h"
+#include "critical.h"
 #include <string.h>
 
-#define CHAIN_INITIAL_SIZE    4
-
 namespace mbed {
 
 typedef void (*pvoidf)(void);
@@ -16,7 +15,9 @@ InterruptManager* InterruptManager::get() {
 }
 
 InterruptManager::InterruptManager() {
-    memset(_chains, 0, NVIC_NUM_VECTORS * sizeof(CallChain*));
+    memset(_chains, 0, NVIC_NUM_VECTORS * sizeof(Chain*));
+    for (int i = 0; i < INTERRUPT_MANAGER_CHAINS; i++)
+        _pool[i].size = 0;
 }
 
 void InterruptManager::destroy() {
@@ -30,51 +31,90 @@ void InterruptManager::destroy() {
 }
 
 InterruptManager::~InterruptManager() {
-    for(int i = 0; i < NVIC_NUM_VECTORS; i++)
-        if (NULL != _chains[i])
-            delete _chains[i];
 }
 
-bool InterruptManager::must_replace_vector(IRQn_Type irq) {
+InterruptManager::Chain* InterruptManager::get_chain(IRQn_Type irq) {
     int irq_pos = get_irq_index(irq);
 
-    if (NULL == _chains[irq_pos]) {
-        _chains[irq_pos] = new CallChain(CHAIN_INITIAL_SIZE);
-        _chains[irq_pos]->add((pvoidf)NVIC_GetVector(irq));
-        return true;
+    if (NULL != _chains[irq_pos])
+        return _chains[irq_pos];
+
+    // Take a free chain from the pool, starting it with the current vector
+    for (int i = 0; i < INTERRUPT_MANAGER_CHAINS; i++) {
+        Chain *chain = &_pool[i];
+        if (chain->size == 0) {
+            chain->vector = NVIC_GetVector(irq);
+            chain->handlers[0].attach((pvoidf)chain->vector);
+            chain->calls[0] = &chain->handlers[0];
+            chain->size = 1;
+            _chains[irq_pos] = chain;
+            return chain;
+        }
     }
-    return false;
+    return (Chain*)NULL;
 }
 
-pFunctionPointer_t InterruptManager::add_common(void (*function)(void), IRQn_Type irq, bool front) {
-    int irq_pos = get_irq_index(irq);
-    bool change = must_replace_vector(irq);
-
-    pFunctionPointer_t pf = front ? _chains[irq_pos]->add_front(function) : _chains[irq_pos]->add(function);
-    if (change)
-        NVIC_SetVector(irq, (uint32_t)&InterruptManager::static_irq_helper);
+pFunctionPointer_t InterruptManager::add_common(const FunctionPointer &handler, IRQn_Type irq, bool front) {
+    pFunctionPointer_t pf = (pFunctionPointer_t)NULL;
+
+    core_util_critical_section_enter();
+    Chain *chain = get_chain(irq);
+    if ((NULL != chain) && (chain->size < INTERRUPT_MANAGER_CHAIN_SIZE)) {
+        // Find the slot no entry of calls refers to
+        for (int slot = 0; NULL == pf; slot++) {
+            pf = &chain->handlers[slot];
+            for (int i = 0; i < chain->size; i++) {
+                if (chain->calls[i] == pf) {
+                    pf = (pFunctionPointer_t)NULL;
+                    break;
+                }
+            }
+        }
+        *pf = handler;
+        if (front) {
+            memmove(&chain->calls[1], &chain->calls[0], chain->size * sizeof(pFunctionPointer_t));
+            chain->calls[0] = pf;
+        } else {
+            chain->calls[chain->size] = pf;
+        }
+        // A newly taken chain holds the original vector and this handler
+        if (++chain->size == 2)
+            NVIC_SetVector(irq, (uint32_t)&InterruptManager::static_irq_helper);
+    }
+    core_util_critical_section_exit();
     return pf;
 }
 
 bool InterruptManager::remove_handler(pFunctionPointer_t handler, IRQn_Type irq) {
     int irq_pos = get_irq_index(irq);
-
-    if (NULL == _chains[irq_pos])
-        return false;
-    if (!_chains[irq_pos]->remove(handler))
-        return false;
-    // If there's a single function left in the chain, swith the interrupt vector
-    // to call that function directly. This way we save both time and space.
-    if (_chains[irq_pos]->size() == 1 && NULL != _chains[irq_pos]->get(0)->get_function()) {
-        NVIC_SetVector(irq, (uint32_t)_chains[irq_pos]->get(0)->get_function());
-        delete _chains[irq_pos];
-        _chains[irq_pos] = (CallChain*) NULL;
+    bool found = false;
+
+    core_util_critical_section_enter();
+    Chain *chain = _chains[irq_pos];
+    if (NULL != chain) {
+        for (int i = 0; i < chain->size; i++) {
+            if (chain->calls[i] == handler) {
+                chain->size--;
+                memmove(&chain->calls[i], &chain->calls[i + 1], (chain->size - i) * sizeof(pFunctionPointer_t));
+                found = true;
+                break;
+            }
+        }
+        // If there's a single function left in the chain, swith the interrupt vector
+        // to call that function directly and give the chain back to the pool.
+        // This way we save both time and space. An empty chain gets the vector
+        // it replaced back, so that it is never left in use by two interrupts.
+        if (found && chain->size == 1 && NULL != chain->calls[0]->get_function()) {
+            NVIC_SetVector(irq, (uint32_t)chain->calls[0]->get_function());
+            chain->size = 0;
+            _chains[irq_pos] = (Chain*)NULL;
+        } else if (found && chain->size == 0) {
+            NVIC_SetVector(irq, chain->vector);
+            _chains[irq_pos] = (Chain*)NULL;
+        }
     }
-    return true;
-}
-
-void InterruptManager::irq_helper() {
-    _chains[__get_IPSR()]->call();
+    core_util_critical_section_exit();
+    return found;
 }
 
 int InterruptManager::get_irq_index(IRQn_Type irq) {
@@ -82,8 +122,11 @@ int InterruptManager::get_irq_index(IRQn_Type irq) {
 }
 
 void InterruptManager::static_irq_helper() {
-    InterruptManager::get()->irq_helper();
+    // Only installed while _instance has a chain for the active interrupt
+    // size is read on each pass as a handler may remove itself
+    Chain *chain = _instance->_chains[__get_IPSR()];
+    for (int i = 0; i < chain->size; i++)
+        chain->calls[i]->call();
 }
 
 } // namespace mbed
-
@@ -14,19 +14,36 @@
  * limitations under the License.
  */
 #include "SPI.h"
+#include "cmsis.h"
+#include "critical.h"
 
 #if DEVICE_SPI
 
 namespace mbed {
 
-SPI::SPI(PinName mosi, PinName miso, PinName sclk, PinName _unused) :
+SPI::SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel) :
         _spi(),
         _bits(8),
         _mode(0),
-        _hz(1000000) {
+        _hz(1000000),
+        _transfer_next(NULL),
+        _transfer_state(TransferIdle),
+        _tx_buffer(NULL),
+        _rx_buffer(NULL),
+        _length(0),
+        _callback(),
+        _event(0),
+        _ssel_pin(ssel) {
     spi_init(&_spi, mosi, miso, sclk, NC);
     spi_format(&_spi, _bits, _mode, 0);
     spi_frequency(&_spi, _hz);
+    if (_ssel_pin != NC) {
+        gpio_init_out_ex(&_ssel, _ssel_pin, 1);
+    }
+}
+
+SPI::~SPI() {
+    abort_transfer();
 }
 
 void SPI::format(int bits, int mode) {
@@ -54,10 +71,149 @@ void SPI::aquire() {
 }
 
 int SPI::write(int value) {
+#if DEVICE_SPI_ASYNCH
+    // let a transfer in progress on the same bus finish first
+    while (spi_active(&_spi));
+#endif
     aquire();
     return spi_master_write(&_spi, value);
 }
 
+void SPI::select(int value) {
+    if (_ssel_pin != NC) {
+        gpio_write(&_ssel, value);
+    }
+}
+
+#if DEVICE_SPI_ASYNCH
+
+SPI* SPI::_transfers = NULL;
+
+int SPI::transfer(const void *tx_buffer, void *rx_buffer, int length,
+                  const event_callback_t &callback, int event) {
+    if (_transfer_state != TransferIdle)
+        return -1;
+    if (length <= 0) {
+        if ((event & SPI_EVENT_COMPLETE) && callback.attached())
+            callback.call(SPI_EVENT_COMPLETE);
+        return 0;
+    }
+    _tx_buffer = tx_buffer;
+    _rx_buffer = rx_buffer;
+    _length = length;
+    _callback = callback;
+    _event = event;
+
+    // transfers are started in the order they were queued
+    core_util_critical_section_enter();
+    SPI **tail = &_transfers;
+    while (*tail != NULL)
+        tail = &(*tail)->_transfer_next;
+    _transfer_next = NULL;
+    *tail = this;
+    _transfer_state = TransferQueued;
+    core_util_critical_section_exit();
+
+    start_queued();
+    return 0;
+}
+
+void SPI::abort_transfer() {
+    core_util_critical_section_enter();
+    if (_transfer_state == TransferActive) {
+        spi_abort_asynch(&_spi);
+        select(1);
+    }
+    if (_transfer_state != TransferIdle) {
+        SPI **p = &_transfers;
+        while (*p != this)
+            p = &(*p)->_transfer_next;
+        *p = _transfer_next;
+        _transfer_state = TransferIdle;
+    }
+    core_util_critical_section_exit();
+
+    start_queued();
+}
+
+// Start the first queued transfer of every idle bus. A bus is busy from
+// the moment its first transfer is started, so later entries for the same
+// bus stay queued.
+void SPI::start_queued() {
+    core_util_critical_section_enter();
+    for (SPI *s = _transfers; s != NULL; s = s->_transfer_next) {
+        if ((s->_transfer_state == TransferQueued) && !spi_active(&s->_spi)) {
+            s->_transfer_state = TransferActive;
+            s->aquire();
+            s->select(0);
+            spi_master_transfer(&s->_spi, s->_tx_buffer, s->_rx_buffer, s->_length,
+                                s->_bits, &SPI::irq_handler_asynch, (uint32_t)s);
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+void SPI::irq_handler_asynch(uint32_t id, int event) {
+    ((SPI*)id)->transfer_done(event);
+}
+
+void SPI::transfer_done(int event) {
+    select(1);
+
+    // the completion of another bus at a higher priority may change the
+    // list meanwhile
+    core_util_critical_section_enter();
+    SPI **p = &_transfers;
+    while (*p != this)
+        p = &(*p)->_transfer_next;
+    *p = _transfer_next;
+    _transfer_state = TransferIdle;
+    core_util_critical_section_exit();
+
+    // the bus is idle while the callback runs, so it may use write() or
+    // queue the next transfer of this object
+    if ((event & _event) && _callback.attached())
+        _callback.call(event & _event);
+
+    start_queued();
+}
+
+#else
+
+int SPI::transfer(const void *tx_buffer, void *rx_buffer, int length,
+                  const event_callback_t &callback, int event) {
+    if (_transfer_state != TransferIdle)
+        return -1;
+    _transfer_state = TransferActive;
+
+    aquire();
+    select(0);
+    for (int i = 0; i < length; i++) {
+        int value = SPI_FILL_WORD;
+        if (tx_buffer != NULL)
+            value = (_bits > 8) ? ((const uint16_t*)tx_buffer)[i] : ((const uint8_t*)tx_buffer)[i];
+        value = spi_master_write(&_spi, value);
+        if (rx_buffer != NULL) {
+            if (_bits > 8) {
+                ((uint16_t*)rx_buffer)[i] = value;
+            } else {
+                ((uint8_t*)rx_buffer)[i] = value;
+            }
+        }
+    }
+    select(1);
+
+    _transfer_state = TransferIdle;
+    if ((event & SPI_EVENT_COMPLETE) && callback.attached())
+        callback.call(SPI_EVENT_COMPLETE);
+    return 0;
+}
+
+void SPI::abort_transfer() {
+}
+
+#endif
+
 } // namespace mbed
 
 #endif
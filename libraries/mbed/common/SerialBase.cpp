@@ -15,12 +15,13 @@
  */
 #include "SerialBase.h"
 #include "wait_api.h"
+#include "Event.h"
 
 #if DEVICE_SERIAL
 
 namespace mbed {
 
-SerialBase::SerialBase(PinName tx, PinName rx) : _serial(), _baud(9600) {
+SerialBase::SerialBase(PinName tx, PinName rx) : _serial(), _irq_event(), _baud(9600) {
     serial_init(&_serial, tx, rx);
     serial_irq_handler(&_serial, SerialBase::_irq_handler, (uint32_t)this);
 }
@@ -44,6 +45,7 @@ int SerialBase::writeable() {
 }
 
 void SerialBase::attach(void (*fptr)(void), IrqType type) {
+    _detach_event(type);
     if (fptr) {
         _irq[type].attach(fptr);
         serial_irq_set(&_serial, (SerialIrq)type, 1);
@@ -52,9 +54,49 @@ void SerialBase::attach(void (*fptr)(void), IrqType type) {
     }
 }
 
+void SerialBase::attach(Event *event, IrqType type) {
+    if (_irq_event[type] != event) {
+        _detach_event(type);
+    }
+    _irq_event[type] = event;
+    if (event) {
+        if (type == RxIrq) {
+            event->attach_done(this, &SerialBase::_rx_irq_enable);
+        } else {
+            event->attach_done(this, &SerialBase::_tx_irq_enable);
+        }
+        serial_irq_set(&_serial, (SerialIrq)type, 1);
+    } else {
+        serial_irq_set(&_serial, (SerialIrq)type, 0);
+    }
+}
+
+void SerialBase::_detach_event(IrqType type) {
+    if (_irq_event[type]) {
+        // a dispatch still pending must not unmask the interrupt any more
+        _irq_event[type]->attach_done();
+        _irq_event[type] = NULL;
+    }
+}
+
+void SerialBase::_rx_irq_enable() {
+    serial_irq_set(&_serial, (SerialIrq)RxIrq, 1);
+}
+
+void SerialBase::_tx_irq_enable() {
+    serial_irq_set(&_serial, (SerialIrq)TxIrq, 1);
+}
+
 void SerialBase::_irq_handler(uint32_t id, SerialIrq irq_type) {
     SerialBase *handler = (SerialBase*)id;
-    handler->_irq[irq_type].call();
+    Event *event = handler->_irq_event[irq_type];
+    if (event) {
+        // keep the interrupt quiet until the deferred handler serviced it
+        serial_irq_set(&handler->_serial, irq_type, 0);
+        event->post();
+    } else {
+        handler->_irq[irq_type].call();
+    }
 }
 
 int SerialBase::_base_getc() {
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "Stream.h"
+#ifdef MBED_MINIMAL_PRINTF
+#include "mbed_printf.h"
+#endif
 
 #include <cstdarg>
 
@@ -90,6 +93,22 @@ off_t Stream::flen() {
     return 0;
 }
 
+#ifdef MBED_MINIMAL_PRINTF
+int Stream::_printf_output(void *context, const char *data, int length) {
+    Stream *stream = (Stream*)context;
+    return (stream->write(data, length) == length) ? 0 : -1;
+}
+
+int Stream::printf(const char* format, ...) {
+    std::va_list arg;
+    va_start(arg, format);
+    fflush(_file);
+    // formatted in chunks straight to write(), bypassing the stdio buffer
+    int r = mbed_vxprintf(_printf_output, this, format, arg);
+    va_end(arg);
+    return r;
+}
+#else
 int Stream::printf(const char* format, ...) {
     std::va_list arg;
     va_start(arg, format);
@@ -98,6 +117,7 @@ int Stream::printf(const char* format, ...) {
     va_end(arg);
     return r;
 }
+#endif
 
 int Stream::scanf(const char* format, ...) {
     std::va_list arg;
@@ -17,6 +17,9 @@
 
 #include "TimerEvent.h"
 #include "FunctionPointer.h"
+#include "Event.h"
+#include "critical.h"
+#include "cmsis.h"
 
 namespace mbed {
 
@@ -25,14 +28,79 @@ void Ticker::detach() {
     _function.attach(0);
 }
 
-void Ticker::setup(unsigned int t) {
+void Ticker::attach_us(Event *event, us_timestamp_t t) {
+    _function.attach(event, &Event::post);
+    setup(t);
+}
+
+void Ticker::attach_stats(TickerStats *stats) {
+    if (stats != NULL) {
+        stats->count = 0;
+        stats->min = 0xFFFFFFFF;
+        stats->max = 0;
+        for (int i = 0; i < MBED_TICKER_BUCKETS; i++) {
+            stats->histogram[i] = 0;
+        }
+    }
+    core_util_critical_section_enter();
+    _stats = stats;
+    core_util_critical_section_exit();
+}
+
+void Ticker::setup(us_timestamp_t t) {
     remove();
     _delay = t;
-    insert(_delay + us_ticker_read());
+    _missed = 0;
+    insert_absolute(_delay + ticker_read64(_ticker_data));
+}
+
+static void record_jitter(TickerStats *stats, us_timestamp_t late) {
+    uint32_t jitter = (late > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)late;
+    int bucket = 0;
+
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+    bucket = 32 - __CLZ(jitter);
+#else
+    for (uint32_t j = jitter; j != 0; j >>= 1) {
+        bucket++;
+    }
+#endif
+    if (bucket >= MBED_TICKER_BUCKETS) {
+        bucket = MBED_TICKER_BUCKETS - 1;
+    }
+    stats->count++;
+    stats->histogram[bucket]++;
+    if (jitter < stats->min) stats->min = jitter;
+    if (jitter > stats->max) stats->max = jitter;
 }
 
 void Ticker::handler() {
-    insert(event.timestamp + _delay);
+    us_timestamp_t now = ticker_read64(_ticker_data);
+    us_timestamp_t late = (now > _target) ? now - _target : 0;
+    us_timestamp_t next = _target + _delay;
+
+    if (_stats != NULL) {
+        record_jitter(_stats, late);
+    }
+
+    // the next period is already over
+    if ((next <= now) && (_delay != 0)) {
+        us_timestamp_t missed = late / _delay;
+        switch (_policy) {
+            case CatchUp:
+                _missed++;
+                break;
+            case Skip:
+                _missed += (uint32_t)missed;
+                next = _target + (missed + 1) * _delay;
+                break;
+            case Coalesce:
+                _missed += (uint32_t)missed;
+                next = now + _delay;
+                break;
+        }
+    }
+    insert_absolute(next);
     _function.call();
 }
 
@@ -18,12 +18,17 @@
 
 namespace mbed {
 
-Timer::Timer() : _running(), _start(), _time() {
+Timer::Timer() : _running(), _start(), _time(), _ticker_data(get_us_ticker_data()) {
+    reset();
+}
+
+Timer::Timer(const ticker_data_t *data) : _running(), _start(), _time(), _ticker_data(data) {
+    data->interface->init();
     reset();
 }
 
 void Timer::start() {
-    _start = us_ticker_read();
+    _start = ticker_read64(_ticker_data);
     _running = 1;
 }
 
@@ -33,27 +38,31 @@ void Timer::stop() {
 }
 
 int Timer::read_us() {
+    return read_high_resolution_us();
+}
+
+us_timestamp_t Timer::read_high_resolution_us() {
     return _time + slicetime();
 }
 
 float Timer::read() {
-    return (float)read_us() / 1000000.0f;
+    return (float)read_high_resolution_us() / 1000000.0f;
 }
 
 int Timer::read_ms() {
-    return read_us() / 1000;
+    return read_high_resolution_us() / 1000;
 }
 
-int Timer::slicetime() {
+us_timestamp_t Timer::slicetime() {
     if (_running) {
-        return us_ticker_read() - _start;
+        return ticker_read64(_ticker_data) - _start;
     } else {
         return 0;
     }
 }
 
 void Timer::reset() {
-    _start = us_ticker_read();
+    _start = ticker_read64(_ticker_data);
     _time = 0;
 }
 
@@ -20,26 +20,62 @@
 
 namespace mbed {
 
-TimerEvent::TimerEvent() : event() {
-    us_ticker_set_handler((&TimerEvent::irq));
+// Longest step queued at once, well inside the range where the wrap
+// aware comparisons of the 32 bit ticker are valid
+#define MAX_STEP_US (1UL << 30)
+
+TimerEvent::TimerEvent() : event(), _target(), _long_wait(false), _ticker_data(get_us_ticker_data()) {
+    ticker_set_handler(_ticker_data, (&TimerEvent::irq));
+}
+
+TimerEvent::TimerEvent(const ticker_data_t *data) : event(), _target(), _long_wait(false), _ticker_data(data) {
+    ticker_set_handler(_ticker_data, (&TimerEvent::irq));
 }
 
 void TimerEvent::irq(uint32_t id) {
     TimerEvent *timer_event = (TimerEvent*)id;
-    timer_event->handler();
+    if (timer_event->_long_wait) {
+        timer_event->schedule();
+    } else {
+        timer_event->handler();
+    }
 }
 
 TimerEvent::~TimerEvent() {
     remove();
 }
 
-// insert in to linked list
+// insert in to the event queue
 void TimerEvent::insert(unsigned int timestamp) {
-    us_ticker_insert_event(&event, timestamp, (uint32_t)this);
+    _long_wait = false;
+    ticker_insert_event(_ticker_data, &event, timestamp, (uint32_t)this);
+}
+
+void TimerEvent::insert_absolute(us_timestamp_t timestamp) {
+    _target = timestamp;
+    schedule();
+}
+
+// Queue the next step towards _target: the target itself when it is
+// close enough, otherwise an intermediate event MAX_STEP_US away
+void TimerEvent::schedule() {
+    us_timestamp_t now = ticker_read64(_ticker_data);
+    uint32_t timestamp;
+    if (_target <= now) {
+        _long_wait = false;
+        timestamp = (uint32_t)now;
+    } else if (_target - now > MAX_STEP_US) {
+        _long_wait = true;
+        timestamp = (uint32_t)(now + MAX_STEP_US);
+    } else {
+        _long_wait = false;
+        timestamp = (uint32_t)_target;
+    }
+    ticker_insert_event(_ticker_data, &event, timestamp, (uint32_t)this);
 }
 
 void TimerEvent::remove() {
-    us_ticker_remove_event(&event);
+    ticker_remove_event(_ticker_data, &event);
 }
 
 } // namespace mbed
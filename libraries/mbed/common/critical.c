@@ -0,0 +1,144 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "critical.h"
+#include "cmsis.h"
+
+#ifdef MBED_CRITICAL_TRACE
+#include "mbed_profile.h"
+#endif
+
+static volatile uint32_t critical_nesting = 0;
+static volatile bool critical_interrupts_disabled = false;
+
+#ifdef MBED_CRITICAL_TRACE
+#if defined(__CC_ARM)
+#define CALLER_ADDRESS()    __return_address()
+#elif defined(__GNUC__)
+#define CALLER_ADDRESS()    __builtin_return_address(0)
+#else
+#define CALLER_ADDRESS()    0
+#endif
+
+static uint32_t trace_start;
+static void *trace_caller;
+static uint32_t trace_threshold;
+static uint32_t trace_max;
+static void *trace_max_caller;
+static core_util_critical_trace_t trace_ring[MBED_CRITICAL_TRACE_SIZE];
+static int trace_head;
+static int trace_count;
+static bool trace_started;
+
+// Called with interrupts disabled at the exit of an outermost section
+static void trace_interval(uint32_t duration, void *caller) {
+    bool longest = duration > trace_max;
+
+    if (longest) {
+        trace_max = duration;
+        trace_max_caller = caller;
+    }
+    if ((trace_threshold != 0) ? (duration > trace_threshold) : longest) {
+        trace_ring[trace_head].caller = caller;
+        trace_ring[trace_head].duration = duration;
+        trace_head = (trace_head + 1) % MBED_CRITICAL_TRACE_SIZE;
+        if (trace_count < MBED_CRITICAL_TRACE_SIZE) {
+            trace_count++;
+        }
+    }
+}
+#endif
+
+bool core_util_are_interrupts_enabled(void) {
+    return ((__get_PRIMASK() & 0x1) == 0);
+}
+
+void core_util_critical_section_enter(void) {
+    bool interrupts_disabled = !core_util_are_interrupts_enabled();
+    __disable_irq();
+
+    // Remember the state of the outermost section only, interrupts are
+    // disabled from here on so the nesting count cannot change under us
+    if (critical_nesting == 0) {
+        critical_interrupts_disabled = interrupts_disabled;
+#ifdef MBED_CRITICAL_TRACE
+        if (!interrupts_disabled) {
+            if (!trace_started) {
+                mbed_profile_init();
+                trace_started = true;
+            }
+            trace_caller = CALLER_ADDRESS();
+            trace_start = mbed_profile_now();
+        }
+#endif
+    }
+    critical_nesting++;
+}
+
+void core_util_critical_section_exit(void) {
+    if (critical_nesting == 0) {
+        return;
+    }
+    if (--critical_nesting == 0 && !critical_interrupts_disabled) {
+#ifdef MBED_CRITICAL_TRACE
+        trace_interval(mbed_profile_now() - trace_start, trace_caller);
+#endif
+        __enable_irq();
+    }
+}
+
+#ifdef MBED_CRITICAL_TRACE
+/* The accessors mask interrupts directly so they do not show up in the trace */
+
+void core_util_critical_trace_threshold(uint32_t duration) {
+    trace_threshold = duration;
+}
+
+uint32_t core_util_critical_trace_max(void **caller) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t duration = trace_max;
+    if (caller != NULL) {
+        *caller = trace_max_caller;
+    }
+    __set_PRIMASK(primask);
+    return duration;
+}
+
+int core_util_critical_trace_read(core_util_critical_trace_t *entries, int count) {
+    int i;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (count > trace_count) {
+        count = trace_count;
+    }
+    for (i = 0; i < count; i++) {
+        entries[i] = trace_ring[(trace_head + MBED_CRITICAL_TRACE_SIZE - 1 - i) % MBED_CRITICAL_TRACE_SIZE];
+    }
+    __set_PRIMASK(primask);
+    return count;
+}
+
+void core_util_critical_trace_reset(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    trace_max = 0;
+    trace_max_caller = NULL;
+    trace_head = 0;
+    trace_count = 0;
+    __set_PRIMASK(primask);
+}
+#endif
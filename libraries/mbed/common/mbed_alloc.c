@@ -0,0 +1,426 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "mbed_alloc.h"
+#include "toolchain.h"
+#include "cmsis.h"
+
+/* Every block starts with a header and its payload follows. The payload
+ * of a free block holds its links in the free list of its size class,
+ * and prev_phys is kept only while the previous block is free, so that
+ * free() can merge with it. Each pool ends with an empty used block. */
+typedef struct block {
+    struct block *prev_phys;
+    size_t size;
+    struct block *next_free;
+    struct block *prev_free;
+} block_t;
+
+#define BLOCK_FREE          1u
+#define BLOCK_PREV_FREE     2u
+#define BLOCK_FLAGS         (BLOCK_FREE | BLOCK_PREV_FREE)
+
+#define ALIGN_LOG2          3
+#define ALIGN               (1u << ALIGN_LOG2)
+#define HEADER_SIZE         offsetof(block_t, next_free)
+#define MIN_PAYLOAD         ((sizeof(block_t) - HEADER_SIZE + ALIGN - 1) & ~(size_t)(ALIGN - 1))
+
+#define SL_COUNT            (1 << MBED_HEAP_SL_LOG2)
+#define FL_SHIFT            (MBED_HEAP_SL_LOG2 + ALIGN_LOG2)
+#define FL_COUNT            (MBED_HEAP_FL_MAX - FL_SHIFT + 1)
+#define SMALL_SIZE          (1u << FL_SHIFT)
+#define MAX_SIZE            ((size_t)1 << MBED_HEAP_FL_MAX)
+
+#if FL_COUNT > 32
+#error "MBED_HEAP_FL_MAX is too large for the first level bitmap"
+#endif
+
+typedef struct {
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[FL_COUNT];
+    block_t *lists[FL_COUNT][SL_COUNT];
+    mbed_alloc_stats_t stats;
+    int initialised;
+} heap_t;
+
+static heap_t heap;
+static uint64_t static_pool[MBED_HEAP_SIZE / sizeof(uint64_t)];
+
+/* Both searches are a single instruction when the core has CLZ, and five
+ * steps otherwise, so allocation time does not depend on the sizes. */
+static int bit_fls(uint32_t word) {
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+    return 31 - (int)__CLZ(word);
+#else
+    int bit = 31;
+    if (word == 0) {
+        return -1;
+    }
+    if (!(word & 0xFFFF0000)) { word <<= 16; bit -= 16; }
+    if (!(word & 0xFF000000)) { word <<= 8;  bit -= 8; }
+    if (!(word & 0xF0000000)) { word <<= 4;  bit -= 4; }
+    if (!(word & 0xC0000000)) { word <<= 2;  bit -= 2; }
+    if (!(word & 0x80000000)) {              bit -= 1; }
+    return bit;
+#endif
+}
+
+static int bit_ffs(uint32_t word) {
+    return bit_fls(word & (~word + 1));
+}
+
+static inline size_t block_size(const block_t *block) {
+    return block->size & ~(size_t)BLOCK_FLAGS;
+}
+
+static inline void *block_payload(block_t *block) {
+    return (char *)block + HEADER_SIZE;
+}
+
+static inline block_t *payload_block(void *ptr) {
+    return (block_t *)((char *)ptr - HEADER_SIZE);
+}
+
+static inline block_t *block_next(block_t *block) {
+    return (block_t *)((char *)block_payload(block) + block_size(block));
+}
+
+static void mapping(size_t size, int *fl, int *sl) {
+    if (size < SMALL_SIZE) {
+        *fl = 0;
+        *sl = (int)(size >> ALIGN_LOG2);
+    } else {
+        int bit = bit_fls((uint32_t)size);
+        *sl = (int)(size >> (bit - MBED_HEAP_SL_LOG2)) ^ SL_COUNT;
+        *fl = bit - FL_SHIFT + 1;
+    }
+}
+
+static void list_insert(block_t *block) {
+    int fl, sl;
+    mapping(block_size(block), &fl, &sl);
+    block->prev_free = NULL;
+    block->next_free = heap.lists[fl][sl];
+    if (block->next_free != NULL) {
+        block->next_free->prev_free = block;
+    }
+    heap.lists[fl][sl] = block;
+    heap.fl_bitmap |= 1u << fl;
+    heap.sl_bitmap[fl] |= 1u << sl;
+    heap.stats.free_size += block_size(block);
+}
+
+static void list_remove(block_t *block) {
+    int fl, sl;
+    mapping(block_size(block), &fl, &sl);
+    if (block->prev_free != NULL) {
+        block->prev_free->next_free = block->next_free;
+    } else {
+        heap.lists[fl][sl] = block->next_free;
+        if (block->next_free == NULL) {
+            heap.sl_bitmap[fl] &= ~(1u << sl);
+            if (heap.sl_bitmap[fl] == 0) {
+                heap.fl_bitmap &= ~(1u << fl);
+            }
+        }
+    }
+    if (block->next_free != NULL) {
+        block->next_free->prev_free = block->prev_free;
+    }
+    heap.stats.free_size -= block_size(block);
+}
+
+/* Marks a block free, merges it with its free neighbours and lists it.
+ * Neighbours are left apart when together they would be too large to list. */
+static void block_release(block_t *block) {
+    block_t *next = block_next(block);
+    if ((block->size & BLOCK_PREV_FREE)
+            && (block_size(block->prev_phys) + HEADER_SIZE + block_size(block) < MAX_SIZE)) {
+        block_t *prev = block->prev_phys;
+        list_remove(prev);
+        prev->size += HEADER_SIZE + block_size(block);
+        block = prev;
+    }
+    if ((next->size & BLOCK_FREE)
+            && (block_size(block) + HEADER_SIZE + block_size(next) < MAX_SIZE)) {
+        list_remove(next);
+        block->size += HEADER_SIZE + block_size(next);
+        next = block_next(block);
+    }
+    block->size |= BLOCK_FREE;
+    next->size |= BLOCK_PREV_FREE;
+    next->prev_phys = block;
+    list_insert(block);
+}
+
+// Trims a used block to size, releasing the tail if it can hold a block
+static void block_trim(block_t *block, size_t size) {
+    if (block_size(block) >= size + HEADER_SIZE + MIN_PAYLOAD) {
+        block_t *tail = (block_t *)((char *)block_payload(block) + size);
+        tail->size = block_size(block) - size - HEADER_SIZE;
+        block->size = size | (block->size & BLOCK_PREV_FREE);
+        block_release(tail);
+    }
+}
+
+static size_t adjust_size(size_t size) {
+    if (size >= MAX_SIZE) {
+        return 0;
+    }
+    size = (size + ALIGN - 1) & ~(size_t)(ALIGN - 1);
+    return (size < MIN_PAYLOAD) ? MIN_PAYLOAD : size;
+}
+
+static block_t *block_find(size_t size) {
+    int fl, sl;
+    uint32_t sl_map;
+    // round up to the next class, whose every block is large enough
+    if (size >= SMALL_SIZE) {
+        size += ((size_t)1 << (bit_fls((uint32_t)size) - MBED_HEAP_SL_LOG2)) - 1;
+    }
+    mapping(size, &fl, &sl);
+    if (fl >= FL_COUNT) {
+        return NULL;
+    }
+    sl_map = heap.sl_bitmap[fl] & (~0u << sl);
+    if (sl_map == 0) {
+        uint32_t fl_map = (fl + 1 < 32) ? heap.fl_bitmap & (~0u << (fl + 1)) : 0;
+        if (fl_map == 0) {
+            return NULL;
+        }
+        fl = bit_ffs(fl_map);
+        sl_map = heap.sl_bitmap[fl];
+    }
+    return heap.lists[fl][bit_ffs(sl_map)];
+}
+
+// Lists the memory as free blocks and returns the sentinel ending them
+static block_t *pool_add(void *start, size_t size) {
+    uintptr_t begin = ((uintptr_t)start + ALIGN - 1) & ~(uintptr_t)(ALIGN - 1);
+    uintptr_t end = ((uintptr_t)start + size) & ~(uintptr_t)(ALIGN - 1);
+    block_t *block, *sentinel;
+    size_t payload;
+
+    if (end <= begin || end - begin < 2 * HEADER_SIZE + MIN_PAYLOAD) {
+        return NULL;
+    }
+    size = end - begin;
+    heap.stats.heap_size += size;
+
+    // blocks larger than the largest class are listed as several blocks
+    block = (block_t *)begin;
+    block->size = 0;
+    size -= HEADER_SIZE;
+    while (size >= HEADER_SIZE + MIN_PAYLOAD) {
+        payload = size - HEADER_SIZE;
+        if (payload >= MAX_SIZE) {
+            payload = MAX_SIZE - ALIGN;
+        }
+        block->size = payload | (block->size & BLOCK_PREV_FREE);
+        sentinel = block_next(block);
+        sentinel->size = 0;
+        block_release(block);
+        block = sentinel;
+        size -= HEADER_SIZE + payload;
+    }
+    return block;
+}
+
+#if defined(TOOLCHAIN_GCC) && !defined(TOOLCHAIN_GCC_NATIVE)
+void *_sbrk(int incr);
+
+/* Takes more memory from _sbrk. A chunk following the previous one turns
+ * the sentinel between them into the header of a new free block. */
+static int heap_grow(size_t size) {
+    static block_t *brk_sentinel;
+    char *chunk;
+    size_t incr = (size + 3 * HEADER_SIZE + 2 * ALIGN) & ~(size_t)(ALIGN - 1);
+    if (incr < MBED_HEAP_GROW_SIZE) {
+        incr = MBED_HEAP_GROW_SIZE;
+    }
+    chunk = (char *)_sbrk((int)incr);
+    if (chunk == (char *)-1) {
+        return -1;
+    }
+    if ((brk_sentinel != NULL) && (chunk == (char *)block_payload(brk_sentinel))
+            && (incr < MAX_SIZE)) {
+        block_t *block = brk_sentinel;
+        block->size = (incr - HEADER_SIZE) | (block->size & BLOCK_PREV_FREE);
+        brk_sentinel = block_next(block);
+        brk_sentinel->size = 0;
+        heap.stats.heap_size += incr;
+        block_release(block);
+        return 0;
+    }
+    brk_sentinel = pool_add(chunk, incr);
+    return (brk_sentinel != NULL) ? 0 : -1;
+}
+#else
+static int heap_grow(size_t size) {
+    (void)size;
+    return -1;
+}
+#endif
+
+static void heap_init(void) {
+    if (!heap.initialised) {
+        heap.initialised = 1;
+        pool_add(static_pool, sizeof(static_pool));
+    }
+}
+
+static void *heap_malloc(size_t size) {
+    block_t *block;
+    size_t adjusted = adjust_size(size);
+
+    heap_init();
+    block = (adjusted != 0) ? block_find(adjusted) : NULL;
+    if ((block == NULL) && (adjusted != 0) && (heap_grow(adjusted) == 0)) {
+        block = block_find(adjusted);
+    }
+    if (block == NULL) {
+        heap.stats.alloc_fail_count++;
+        return NULL;
+    }
+    list_remove(block);
+    block->size &= ~(size_t)BLOCK_FREE;
+    block_next(block)->size &= ~(size_t)BLOCK_PREV_FREE;
+    block_trim(block, adjusted);
+
+    heap.stats.alloc_count++;
+    heap.stats.allocated_size += block_size(block);
+    if (heap.stats.allocated_size > heap.stats.max_allocated_size) {
+        heap.stats.max_allocated_size = heap.stats.allocated_size;
+    }
+    return block_payload(block);
+}
+
+static void heap_free(void *ptr) {
+    block_t *block = payload_block(ptr);
+    heap.stats.alloc_count--;
+    heap.stats.allocated_size -= block_size(block);
+    block_release(block);
+}
+
+void *mbed_alloc_malloc(size_t size) {
+    void *ptr;
+    mbed_alloc_lock();
+    ptr = heap_malloc(size);
+    mbed_alloc_unlock();
+    return ptr;
+}
+
+void mbed_alloc_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    mbed_alloc_lock();
+    heap_free(ptr);
+    mbed_alloc_unlock();
+}
+
+void *mbed_alloc_realloc(void *ptr, size_t size) {
+    block_t *block, *next;
+    size_t adjusted, old_size;
+    void *moved;
+
+    if (ptr == NULL) {
+        return mbed_alloc_malloc(size);
+    }
+    if (size == 0) {
+        mbed_alloc_free(ptr);
+        return NULL;
+    }
+    adjusted = adjust_size(size);
+    if (adjusted == 0) {
+        return NULL;
+    }
+
+    mbed_alloc_lock();
+    block = payload_block(ptr);
+    old_size = block_size(block);
+    next = block_next(block);
+    // grow into the next block when it is free and large enough
+    if ((adjusted > old_size) && (next->size & BLOCK_FREE)
+            && (old_size + HEADER_SIZE + block_size(next) >= adjusted)) {
+        list_remove(next);
+        block->size += HEADER_SIZE + block_size(next);
+        block_next(block)->size &= ~(size_t)BLOCK_PREV_FREE;
+    }
+    if (block_size(block) >= adjusted) {
+        block_trim(block, adjusted);
+        heap.stats.allocated_size += block_size(block) - old_size;
+        if (heap.stats.allocated_size > heap.stats.max_allocated_size) {
+            heap.stats.max_allocated_size = heap.stats.allocated_size;
+        }
+        mbed_alloc_unlock();
+        return ptr;
+    }
+
+    moved = heap_malloc(size);
+    if (moved != NULL) {
+        memcpy(moved, ptr, old_size);
+        heap_free(ptr);
+    }
+    mbed_alloc_unlock();
+    return moved;
+}
+
+void *mbed_alloc_calloc(size_t count, size_t size) {
+    void *ptr;
+    if ((size != 0) && (count > (size_t)-1 / size)) {
+        return NULL;
+    }
+    ptr = mbed_alloc_malloc(count * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+int mbed_alloc_add_pool(void *start, size_t size) {
+    int ret;
+    mbed_alloc_lock();
+    heap_init();
+    ret = (pool_add(start, size) != NULL) ? 0 : -1;
+    mbed_alloc_unlock();
+    return ret;
+}
+
+void mbed_alloc_get_stats(mbed_alloc_stats_t *stats) {
+    int fl;
+    mbed_alloc_lock();
+    heap_init();
+    *stats = heap.stats;
+    stats->largest_free_size = 0;
+    // the largest block is in the highest list, but not always at its head
+    fl = bit_fls(heap.fl_bitmap);
+    if (fl >= 0) {
+        block_t *block = heap.lists[fl][bit_fls(heap.sl_bitmap[fl])];
+        for (; block != NULL; block = block->next_free) {
+            if (block_size(block) > stats->largest_free_size) {
+                stats->largest_free_size = block_size(block);
+            }
+        }
+    }
+    mbed_alloc_unlock();
+}
+
+WEAK void mbed_alloc_lock(void) {
+}
+
+WEAK void mbed_alloc_unlock(void) {
+}
@@ -0,0 +1,607 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "mbed_printf.h"
+
+typedef struct {
+    mbed_printf_output output;
+    void *context;
+    int count;
+    int error;
+    int used;
+    char chunk[MBED_PRINTF_CHUNK];
+} printer_t;
+
+typedef struct {
+    char left;
+    char plus;
+    char space;
+    char alt;
+    char zero;
+    int width;
+    int precision;      // -1 if not given
+} spec_t;
+
+static void flush(printer_t *p) {
+    if ((p->used > 0) && !p->error) {
+        if (p->output(p->context, p->chunk, p->used) < 0) {
+            p->error = 1;
+        }
+    }
+    p->used = 0;
+}
+
+static void put(printer_t *p, char c) {
+    p->chunk[p->used++] = c;
+    p->count++;
+    if (p->used == MBED_PRINTF_CHUNK) {
+        flush(p);
+    }
+}
+
+static void put_repeat(printer_t *p, char c, int n) {
+    while (n-- > 0) {
+        put(p, c);
+    }
+}
+
+static void put_string(printer_t *p, const char *s, int n) {
+    while (n-- > 0) {
+        put(p, *s++);
+    }
+}
+
+/* Emit prefix, zeros and body padded to the field width. The zero flag
+   pads with zeros between the prefix and the body. */
+static void put_field(printer_t *p, const spec_t *s, const char *prefix, int prefix_len,
+                      int zeros, const char *body, int body_len) {
+    int pad = s->width - (prefix_len + zeros + body_len);
+    if (pad < 0) {
+        pad = 0;
+    }
+    if (s->zero && !s->left) {
+        zeros += pad;
+        pad = 0;
+    }
+    if (!s->left) {
+        put_repeat(p, ' ', pad);
+    }
+    put_string(p, prefix, prefix_len);
+    put_repeat(p, '0', zeros);
+    put_string(p, body, body_len);
+    if (s->left) {
+        put_repeat(p, ' ', pad);
+    }
+}
+
+/* Write the digits of value in base at the end of buf, return the start */
+static char *format_unsigned(char *end, unsigned long long value, int base, int upper) {
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char *p = end;
+
+    // most values fit in 32 bits, which avoids the 64 bit division
+    while (value > 0xFFFFFFFFUL) {
+        *--p = digits[value % base];
+        value /= base;
+    }
+    uint32_t v = (uint32_t)value;
+    while (v != 0) {
+        *--p = digits[v % base];
+        v /= base;
+    }
+    return p;
+}
+
+static void put_integer(printer_t *p, spec_t *s, unsigned long long value, int negative,
+                        int base, int upper) {
+    char buf[24];
+    char prefix[2];
+    int prefix_len = 0;
+    char *end = buf + sizeof(buf);
+    char *start = format_unsigned(end, value, base, upper);
+    int len = end - start;
+
+    if (negative) {
+        prefix[prefix_len++] = '-';
+    } else if (s->plus) {
+        prefix[prefix_len++] = '+';
+    } else if (s->space) {
+        prefix[prefix_len++] = ' ';
+    }
+    if (s->alt && (value != 0)) {
+        if (base == 16) {
+            prefix[prefix_len++] = '0';
+            prefix[prefix_len++] = upper ? 'X' : 'x';
+        } else if ((base == 8) && (s->precision <= len)) {
+            s->precision = len + 1;
+        }
+    }
+
+    int zeros = 0;
+    if (s->precision >= 0) {
+        // an explicit precision disables the zero flag, 0 prints no digits for 0
+        s->zero = 0;
+        if (s->precision > len) {
+            zeros = s->precision - len;
+        }
+    } else if (len == 0) {
+        zeros = 1;
+    }
+    if ((len == 0) && s->alt && (base == 8)) {
+        zeros = 1;
+    }
+    put_field(p, s, prefix, prefix_len, zeros, start, len);
+}
+
+#ifndef MBED_PRINTF_INTEGER_ONLY
+static const uint32_t powers_of_10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/* Fixed notation of a non negative value below 2^64 with precision 0-9 */
+static int format_fixed(char *buf, double value, int precision, int alt) {
+    unsigned long long integer = (unsigned long long)value;
+    uint32_t scale = powers_of_10[precision];
+    uint32_t fraction = (uint32_t)((value - (double)integer) * scale + 0.5);
+    char digits[24];
+    char *end = digits + sizeof(digits);
+    int len = 0;
+
+    if (fraction >= scale) {
+        fraction -= scale;
+        integer++;
+    }
+    char *start = format_unsigned(end, integer, 10, 0);
+    if (start == end) {
+        *--start = '0';
+    }
+    while (start != end) {
+        buf[len++] = *start++;
+    }
+    if ((precision > 0) || alt) {
+        buf[len++] = '.';
+    }
+    for (int i = precision - 1; i >= 0; i--) {
+        buf[len + i] = '0' + fraction % 10;
+        fraction /= 10;
+    }
+    return len + precision;
+}
+
+/* Scale a positive value into [1, 10) */
+static double normalize(double value, int *exponent) {
+    int e = 0;
+    while (value >= 1e8) {
+        value /= 1e8;
+        e += 8;
+    }
+    while (value >= 10.0) {
+        value /= 10.0;
+        e++;
+    }
+    while (value < 1e-8) {
+        value *= 1e8;
+        e -= 8;
+    }
+    while (value < 1.0) {
+        value *= 10.0;
+        e--;
+    }
+    *exponent = e;
+    return value;
+}
+
+/* Exponent notation of a non negative value with precision 0-9 */
+static int format_exponent(char *buf, double value, int precision, int alt, int upper) {
+    int exponent = 0;
+    if (value != 0.0) {
+        value = normalize(value, &exponent);
+        // rounding may carry into a new digit, 9.99 -> 10.0
+        if (value + 0.5 / powers_of_10[precision] >= 10.0) {
+            value /= 10.0;
+            exponent++;
+        }
+    }
+    int len = format_fixed(buf, value, precision, alt);
+    buf[len++] = upper ? 'E' : 'e';
+    if (exponent < 0) {
+        buf[len++] = '-';
+        exponent = -exponent;
+    } else {
+        buf[len++] = '+';
+    }
+    if (exponent >= 100) {
+        buf[len++] = '0' + exponent / 100;
+    }
+    buf[len++] = '0' + (exponent / 10) % 10;
+    buf[len++] = '0' + exponent % 10;
+    return len;
+}
+
+/* Remove trailing zeros of the fraction, and the point if nothing is left */
+static int strip_zeros(char *buf, int len) {
+    int point = -1;
+    int exp_start = len;
+    for (int i = 0; i < len; i++) {
+        if (buf[i] == '.') {
+            point = i;
+        } else if ((buf[i] == 'e') || (buf[i] == 'E')) {
+            exp_start = i;
+        }
+    }
+    if (point < 0) {
+        return len;
+    }
+    int end = exp_start;
+    while ((end > point + 1) && (buf[end - 1] == '0')) {
+        end--;
+    }
+    if (end == point + 1) {
+        end = point;
+    }
+    for (int i = exp_start; i < len; i++) {
+        buf[end++] = buf[i];
+    }
+    return end;
+}
+
+/* Fixed notation of a value of 2^64 and more: the 17 significant digits a
+   double holds followed by zeros, there is no fraction to print */
+static void put_fixed_large(printer_t *p, const spec_t *s, const char *prefix, int prefix_len,
+                            double value, int precision) {
+    int exponent;
+    normalize(value, &exponent);
+    // one division, exact while the divisor is below 1e23
+    double divisor = 1.0;
+    for (int i = 16; i < exponent; i++) {
+        divisor *= 10.0;
+    }
+    unsigned long long significand = (unsigned long long)(value / divisor + 0.5);
+    if (significand >= 100000000000000000ULL) {
+        significand /= 10;
+        exponent++;
+    }
+    char digits[24];
+    char *end = digits + sizeof(digits);
+    char *start = format_unsigned(end, significand, 10, 0);
+    int zeros = exponent - 16;
+    int point = (precision > 0) || s->alt;
+
+    int pad = s->width - (prefix_len + (int)(end - start) + zeros + point + precision);
+    if (pad < 0) {
+        pad = 0;
+    }
+    if (!s->left && !s->zero) {
+        put_repeat(p, ' ', pad);
+    }
+    put_string(p, prefix, prefix_len);
+    if (!s->left && s->zero) {
+        put_repeat(p, '0', pad);
+    }
+    put_string(p, start, (int)(end - start));
+    put_repeat(p, '0', zeros);
+    if (point) {
+        put(p, '.');
+    }
+    put_repeat(p, '0', precision);
+    if (s->left) {
+        put_repeat(p, ' ', pad);
+    }
+}
+
+static void put_float(printer_t *p, spec_t *s, double value, char conversion) {
+    char buf[40];
+    char prefix[1];
+    int prefix_len = 0;
+    int upper = (conversion == 'F') || (conversion == 'E') || (conversion == 'G');
+    int len;
+
+    // signbit() also catches -0.0
+    if (signbit(value)) {
+        value = -value;
+        prefix[prefix_len++] = '-';
+    } else if (s->plus) {
+        prefix[prefix_len++] = '+';
+    } else if (s->space) {
+        prefix[prefix_len++] = ' ';
+    }
+
+    if (value != value) {
+        s->zero = 0;
+        put_field(p, s, prefix, prefix_len, 0, upper ? "NAN" : "nan", 3);
+        return;
+    }
+    if (value > 1.7976931348623157e308) {
+        s->zero = 0;
+        put_field(p, s, prefix, prefix_len, 0, upper ? "INF" : "inf", 3);
+        return;
+    }
+
+    int precision = (s->precision < 0) ? 6 : s->precision;
+    if ((conversion == 'g') || (conversion == 'G')) {
+        // precision is the number of significant digits
+        int exponent = 0;
+        if (precision == 0) {
+            precision = 1;
+        }
+        if (precision > 10) {
+            precision = 10;
+        }
+        if (value != 0.0) {
+            double scaled = normalize(value, &exponent);
+            if (scaled + 0.5 / powers_of_10[precision - 1] >= 10.0) {
+                exponent++;
+            }
+        }
+        if ((exponent < -4) || (exponent >= precision) || (value >= 1.8e19) ||
+            (precision - 1 - exponent > 9)) {
+            len = format_exponent(buf, value, precision - 1, s->alt, upper);
+        } else {
+            len = format_fixed(buf, value, precision - 1 - exponent, s->alt);
+        }
+        if (!s->alt) {
+            len = strip_zeros(buf, len);
+        }
+    } else {
+        if (precision > 9) {
+            precision = 9;
+        }
+        if ((conversion == 'e') || (conversion == 'E')) {
+            len = format_exponent(buf, value, precision, s->alt, upper);
+        } else if (value >= 1.8e19) {
+            put_fixed_large(p, s, prefix, prefix_len, value, precision);
+            return;
+        } else {
+            len = format_fixed(buf, value, precision, s->alt);
+        }
+    }
+
+    put_field(p, s, prefix, prefix_len, 0, buf, len);
+}
+#endif
+
+int mbed_vxprintf(mbed_printf_output output, void *context, const char *format, va_list arg) {
+    printer_t p;
+    p.output = output;
+    p.context = context;
+    p.count = 0;
+    p.error = 0;
+    p.used = 0;
+
+    while (*format) {
+        if (*format != '%') {
+            put(&p, *format++);
+            continue;
+        }
+        const char *start = format++;
+
+        spec_t s = {0, 0, 0, 0, 0, 0, -1};
+        for (;; format++) {
+            if (*format == '-') s.left = 1;
+            else if (*format == '+') s.plus = 1;
+            else if (*format == ' ') s.space = 1;
+            else if (*format == '#') s.alt = 1;
+            else if (*format == '0') s.zero = 1;
+            else break;
+        }
+
+        if (*format == '*') {
+            s.width = va_arg(arg, int);
+            if (s.width < 0) {
+                s.left = 1;
+                s.width = -s.width;
+            }
+            format++;
+        } else {
+            while ((*format >= '0') && (*format <= '9')) {
+                s.width = s.width * 10 + (*format++ - '0');
+            }
+        }
+
+        if (*format == '.') {
+            format++;
+            s.precision = 0;
+            if (*format == '*') {
+                s.precision = va_arg(arg, int);
+                if (s.precision < 0) {
+                    s.precision = -1;
+                }
+                format++;
+            } else {
+                while ((*format >= '0') && (*format <= '9')) {
+                    s.precision = s.precision * 10 + (*format++ - '0');
+                }
+            }
+        }
+
+        // length modifier: 'H' for hh, 'L' for ll and L
+        char length = 0;
+        switch (*format) {
+            case 'h':
+                length = (*++format == 'h') ? (format++, 'H') : 'h';
+                break;
+            case 'l':
+                length = (*++format == 'l') ? (format++, 'L') : 'l';
+                break;
+            case 'L':
+            case 'j':
+            case 'z':
+            case 't':
+                length = *format++;
+                break;
+        }
+
+        char conversion = *format;
+        if (conversion == '\0') {
+            // incomplete specification at the end of the format
+            put_string(&p, start, format - start);
+            break;
+        }
+        format++;
+
+        switch (conversion) {
+            case 'd':
+            case 'i': {
+                long long value;
+                switch (length) {
+                    case 'H': value = (signed char)va_arg(arg, int); break;
+                    case 'h': value = (short)va_arg(arg, int); break;
+                    case 'l': value = va_arg(arg, long); break;
+                    case 'L': value = va_arg(arg, long long); break;
+                    case 'j': value = va_arg(arg, intmax_t); break;
+                    case 'z': value = (long long)va_arg(arg, size_t); break;
+                    case 't': value = va_arg(arg, ptrdiff_t); break;
+                    default:  value = va_arg(arg, int); break;
+                }
+                int negative = value < 0;
+                put_integer(&p, &s, negative ? 0ULL - (unsigned long long)value : (unsigned long long)value,
+                            negative, 10, 0);
+                break;
+            }
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X': {
+                unsigned long long value;
+                switch (length) {
+                    case 'H': value = (unsigned char)va_arg(arg, unsigned int); break;
+                    case 'h': value = (unsigned short)va_arg(arg, unsigned int); break;
+                    case 'l': value = va_arg(arg, unsigned long); break;
+                    case 'L': value = va_arg(arg, unsigned long long); break;
+                    case 'j': value = va_arg(arg, uintmax_t); break;
+                    case 'z': value = va_arg(arg, size_t); break;
+                    case 't': value = (unsigned long long)va_arg(arg, ptrdiff_t); break;
+                    default:  value = va_arg(arg, unsigned int); break;
+                }
+                s.plus = s.space = 0;
+                int base = (conversion == 'u') ? 10 : (conversion == 'o') ? 8 : 16;
+                put_integer(&p, &s, value, 0, base, conversion == 'X');
+                break;
+            }
+            case 'p':
+                s.plus = s.space = 0;
+                s.alt = 1;
+                put_integer(&p, &s, (uintptr_t)va_arg(arg, void*), 0, 16, 0);
+                break;
+            case 'c': {
+                char c = (char)va_arg(arg, int);
+                s.zero = 0;
+                put_field(&p, &s, NULL, 0, 0, &c, 1);
+                break;
+            }
+            case 's': {
+                const char *str = va_arg(arg, const char*);
+                int len = 0;
+                if (str == NULL) {
+                    str = "(null)";
+                }
+                while (str[len] && ((s.precision < 0) || (len < s.precision))) {
+                    len++;
+                }
+                s.zero = 0;
+                put_field(&p, &s, NULL, 0, 0, str, len);
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+#ifndef MBED_PRINTF_INTEGER_ONLY
+                if (length == 'L') {
+                    put_float(&p, &s, (double)va_arg(arg, long double), conversion);
+                } else {
+                    put_float(&p, &s, va_arg(arg, double), conversion);
+                }
+#else
+                if (length == 'L') {
+                    (void)va_arg(arg, long double);
+                } else {
+                    (void)va_arg(arg, double);
+                }
+                put_string(&p, start, format - start);
+#endif
+                break;
+            case '%':
+                put(&p, '%');
+                break;
+            default:
+                // unknown conversion, print it as it is
+                put_string(&p, start, format - start);
+                break;
+        }
+    }
+    flush(&p);
+    return p.error ? -1 : p.count;
+}
+
+int mbed_xprintf(mbed_printf_output output, void *context, const char *format, ...) {
+    va_list arg;
+    va_start(arg, format);
+    int r = mbed_vxprintf(output, context, format, arg);
+    va_end(arg);
+    return r;
+}
+
+typedef struct {
+    char *buffer;
+    size_t left;
+} buffer_output_t;
+
+static int buffer_output(void *context, const char *data, int length) {
+    buffer_output_t *b = (buffer_output_t*)context;
+    while ((length-- > 0) && (b->left > 1)) {
+        *b->buffer++ = *data++;
+        b->left--;
+    }
+    return 0;
+}
+
+int mbed_vsnprintf(char *buffer, size_t size, const char *format, va_list arg) {
+    buffer_output_t b = {buffer, size};
+    int r = mbed_vxprintf(buffer_output, &b, format, arg);
+    if (size > 0) {
+        *b.buffer = '\0';
+    }
+    return r;
+}
+
+int mbed_snprintf(char *buffer, size_t size, const char *format, ...) {
+    va_list arg;
+    va_start(arg, format);
+    int r = mbed_vsnprintf(buffer, size, format, arg);
+    va_end(arg);
+    return r;
+}
+
+static int stdout_output(void *context, const char *data, int length) {
+    return (fwrite(data, 1, length, stdout) == (size_t)length) ? 0 : -1;
+}
+
+int mbed_vprintf(const char *format, va_list arg) {
+    return mbed_vxprintf(stdout_output, NULL, format, arg);
+}
+
+int mbed_printf(const char *format, ...) {
+    va_list arg;
+    va_start(arg, format);
+    int r = mbed_vprintf(format, arg);
+    va_end(arg);
+    return r;
+}
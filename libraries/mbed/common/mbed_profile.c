@@ -0,0 +1,140 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include "mbed_profile.h"
+#include "critical.h"
+
+#if !defined(__CORTEX_M)
+#include <time.h>
+#endif
+
+static mbed_profile_site_t sites[MBED_PROFILE_SITES];
+static int site_count;
+
+#if !defined(__CORTEX_M)
+uint32_t mbed_profile_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+#endif
+
+static void site_clear(mbed_profile_site_t *s) {
+    int i;
+    s->count = 0;
+    s->min = 0xFFFFFFFF;
+    s->max = 0;
+    s->total = 0;
+    for (i = 0; i < MBED_PROFILE_BUCKETS; i++) {
+        s->histogram[i] = 0;
+    }
+}
+
+static int log2_bucket(uint32_t value) {
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+    return 31 - __CLZ(value | 1);
+#else
+    int bucket = 0;
+    while (value >>= 1) {
+        bucket++;
+    }
+    return bucket;
+#endif
+}
+
+void mbed_profile_init(void) {
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t mbed_profile_start(int *site, const char *name) {
+    if (*site < 0) {
+        core_util_critical_section_enter();
+        // another context may have registered it in the meantime
+        if ((*site < 0) && (site_count < MBED_PROFILE_SITES)) {
+            if (site_count == 0) {
+                mbed_profile_init();
+            }
+            sites[site_count].name = name;
+            site_clear(&sites[site_count]);
+            *site = site_count++;
+        }
+        core_util_critical_section_exit();
+    }
+    return mbed_profile_now();
+}
+
+void mbed_profile_record(int site, uint32_t elapsed) {
+    if (site < 0) {
+        return;
+    }
+    mbed_profile_site_t *s = &sites[site];
+
+    core_util_critical_section_enter();
+    s->count++;
+    s->total += elapsed;
+    if (elapsed < s->min) s->min = elapsed;
+    if (elapsed > s->max) s->max = elapsed;
+    s->histogram[log2_bucket(elapsed)]++;
+    core_util_critical_section_exit();
+}
+
+int mbed_profile_count(void) {
+    return site_count;
+}
+
+const mbed_profile_site_t *mbed_profile_get(int site) {
+    if ((site < 0) || (site >= site_count)) {
+        return NULL;
+    }
+    return &sites[site];
+}
+
+void mbed_profile_reset(void) {
+    int i;
+    core_util_critical_section_enter();
+    for (i = 0; i < site_count; i++) {
+        site_clear(&sites[i]);
+    }
+    core_util_critical_section_exit();
+}
+
+void mbed_profile_dump(void) {
+    int i, b;
+    mbed_profile_site_t s;
+
+    printf("%-24s %10s %10s %10s %10s (%s)\r\n", "site", "count", "min", "mean", "max", MBED_PROFILE_UNIT);
+    for (i = 0; i < site_count; i++) {
+        // print from a copy so the statistics stay consistent
+        core_util_critical_section_enter();
+        s = sites[i];
+        core_util_critical_section_exit();
+
+        if (s.count == 0) {
+            printf("%-24s %10u\r\n", s.name, 0u);
+            continue;
+        }
+        printf("%-24s %10lu %10lu %10lu %10lu\r\n", s.name, (unsigned long)s.count,
+               (unsigned long)s.min, (unsigned long)(s.total / s.count), (unsigned long)s.max);
+        for (b = 0; b < MBED_PROFILE_BUCKETS; b++) {
+            if (s.histogram[b]) {
+                printf("    >= 2^%-2d %10lu\r\n", b, (unsigned long)s.histogram[b]);
+            }
+        }
+    }
+}
@@ -19,12 +19,13 @@
 #include "FilePath.h"
 #include "serial_api.h"
 #include "toolchain.h"
+#include "critical.h"
+#include "mbed_retarget.h"
 #include <errno.h>
 
 #if defined(__ARMCC_VERSION)
 #   include <rt_sys.h>
 #   define PREFIX(x)    _sys##x
-#   define OPEN_MAX     _SYS_OPEN
 #   ifdef __MICROLIB
 #       pragma import(__use_full_stdio)
 #   endif
@@ -32,12 +33,18 @@
 #elif defined(__ICCARM__)
 #   include <yfuns.h>
 #   define PREFIX(x)        _##x
-#   define OPEN_MAX         16
 
 #   define STDIN_FILENO     0
 #   define STDOUT_FILENO    1
 #   define STDERR_FILENO    2
 
+#elif defined(TOOLCHAIN_GCC_NATIVE)
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   include <limits.h>
+#   include <stdint.h>
+#   define PREFIX(x)    x
+
 #else
 #   include <sys/stat.h>
 #   include <sys/unistd.h>
@@ -45,6 +52,16 @@
 #   define PREFIX(x)    x
 #endif
 
+/* glibc has its own descriptors and the host file system has to stay
+ * reachable, so the native toolchain wraps these calls at link time and
+ * passes the names that no FileBase claims on to the host.
+ */
+#if defined(TOOLCHAIN_GCC_NATIVE)
+#   define WRAPPED(x)   __wrap_##x
+#else
+#   define WRAPPED(x)   x
+#endif
+
 using namespace mbed;
 
 #if defined(__MICROLIB) && (__ARMCC_VERSION>5030000)
@@ -64,15 +81,116 @@ extern const char __stderr_name[] = "/stderr";
  * put it in a filehandles array and return the index into that array
  * (or rather index+3, as filehandles 0-2 are stdin/out/err).
  */
-static FileHandle *filehandles[OPEN_MAX];
+static FileHandle *filehandles[MBED_OPEN_MAX];
 
-FileHandle::~FileHandle() {
-    /* Remove all open filehandles for this */
-    for (unsigned int fh_i = 0; fh_i < sizeof(filehandles)/sizeof(*filehandles); fh_i++) {
-        if (filehandles[fh_i] == this) {
-            filehandles[fh_i] = NULL;
+namespace mbed {
+
+/* Descriptor allocation without searching the table. Released descriptors
+ * are kept on a free list and the ones never used yet are taken in order.
+ * The descriptors open on a FileHandle are chained from FileHandle::_fd
+ * through the same next links, so its destructor only visits those.
+ */
+class FileDescriptors {
+public:
+    static int take() {
+        core_util_critical_section_enter();
+        int fd = -1;
+        if (_free >= 0) {
+            fd = _free;
+            _free = _next[fd];
+        } else if (_unused < MBED_OPEN_MAX) {
+            fd = _unused++;
+        }
+        if (fd >= 0) {
+            _in_use[fd] = true;
+        }
+        core_util_critical_section_exit();
+        return fd;
+    }
+
+    static void attach(int fd, FileHandle *fh) {
+        core_util_critical_section_enter();
+        filehandles[fd] = fh;
+        _next[fd] = fh->_fd;
+        fh->_fd = fd;
+        core_util_critical_section_exit();
+    }
+
+    // Returns the handle fd was open on, NULL if it was detached already
+    static FileHandle *release(int fd) {
+        core_util_critical_section_enter();
+        FileHandle *fh = filehandles[fd];
+        filehandles[fd] = NULL;
+        if (fh != NULL) {
+            int *link = &fh->_fd;
+            while (*link != fd) {
+                link = &_next[*link];
+            }
+            *link = _next[fd];
         }
+        _in_use[fd] = false;
+        _next[fd] = _free;
+        _free = fd;
+        core_util_critical_section_exit();
+        return fh;
     }
+
+    // The descriptors stay allocated until they are closed
+    static void detach(FileHandle *fh) {
+        core_util_critical_section_enter();
+        for (int fd = fh->_fd; fd >= 0; fd = _next[fd]) {
+            filehandles[fd] = NULL;
+        }
+        fh->_fd = -1;
+        core_util_critical_section_exit();
+    }
+
+    static bool in_use(int fd) {
+        return (fd >= 0) && (fd < MBED_OPEN_MAX) && _in_use[fd];
+    }
+
+private:
+    static int _next[MBED_OPEN_MAX];
+    static bool _in_use[MBED_OPEN_MAX];
+    static int _free;
+    static int _unused;
+};
+
+int FileDescriptors::_next[MBED_OPEN_MAX];
+bool FileDescriptors::_in_use[MBED_OPEN_MAX];
+int FileDescriptors::_free = -1;
+int FileDescriptors::_unused = 0;
+
+} // namespace mbed
+
+FileHandle::~FileHandle() {
+    /* Remove all open filehandles for this */
+    FileDescriptors::detach(this);
+}
+
+/* Lock descriptor fh and return its FileHandle, or NULL without keeping the
+ * lock if fh is not open */
+static FileHandle *lock_filehandle(FILEHANDLE fh) {
+    int fd = fh - 3;
+    if (!FileDescriptors::in_use(fd)) return NULL;
+
+    mbed_filehandle_lock(fd);
+    FileHandle *fhc = filehandles[fd];
+    if (fhc == NULL) mbed_filehandle_unlock(fd);
+    return fhc;
+}
+
+static void unlock_filehandle(FILEHANDLE fh) {
+    mbed_filehandle_unlock(fh - 3);
+}
+
+extern "C" WEAK void mbed_filehandle_lock_init(int fd) {
+}
+
+extern "C" WEAK void mbed_filehandle_lock(int fd) {
+}
+
+extern "C" WEAK void mbed_filehandle_unlock(int fd) {
 }
 
 #if DEVICE_SERIAL
@@ -120,6 +238,29 @@ static inline int openmode_to_posix(int openmode) {
     return posix;
 }
 
+static FileHandle *open_filehandle(const char* name, int openmode) {
+    /* FILENAME: ":0x12345678" describes a FileLike* */
+    if (name[0] == ':') {
+        void *p;
+        sscanf(name, ":%p", &p);
+        return (FileHandle*)p;
+    }
+
+    /* FILENAME: "/file_system/file_name" */
+    FilePath path(name);
+
+    if (!path.exists())
+        return NULL;
+    else if (path.isFile()) {
+        return path.file();
+    } else {
+        FileSystemLike *fs = path.fileSystem();
+        if (fs == NULL) return NULL;
+        int posix_mode = openmode_to_posix(openmode);
+        return fs->open(path.fileName(), posix_mode); /* NULL if fails */
+    }
+}
+
 extern "C" FILEHANDLE PREFIX(_open)(const char* name, int openmode) {
     #if defined(__MICROLIB) && (__ARMCC_VERSION>5030000)
     // Before version 5.03, we were using a patched version of microlib with proper names
@@ -142,50 +283,28 @@ extern "C" FILEHANDLE PREFIX(_open)(const char* name, int openmode) {
     }
     #endif
 
-    // find the first empty slot in filehandles
-    unsigned int fh_i;
-    for (fh_i = 0; fh_i < sizeof(filehandles)/sizeof(*filehandles); fh_i++) {
-        if (filehandles[fh_i] == NULL) break;
-    }
-    if (fh_i >= sizeof(filehandles)/sizeof(*filehandles)) {
-        return -1;
-    }
-
-    FileHandle *res;
-
-    /* FILENAME: ":0x12345678" describes a FileLike* */
-    if (name[0] == ':') {
-        void *p;
-        sscanf(name, ":%p", &p);
-        res = (FileHandle*)p;
+    int fd = FileDescriptors::take();
+    if (fd < 0) return -1;
 
-    /* FILENAME: "/file_system/file_name" */
-    } else {
-        FilePath path(name);
-
-        if (!path.exists())
-            return -1;
-        else if (path.isFile()) {
-            res = path.file();
-        } else {
-            FileSystemLike *fs = path.fileSystem();
-            if (fs == NULL) return -1;
-            int posix_mode = openmode_to_posix(openmode);
-            res = fs->open(path.fileName(), posix_mode); /* NULL if fails */
-        }
+    FileHandle *res = open_filehandle(name, openmode);
+    if (res == NULL) {
+        FileDescriptors::release(fd);
+        return -1;
     }
+    mbed_filehandle_lock_init(fd);
+    FileDescriptors::attach(fd, res);
 
-    if (res == NULL) return -1;
-    filehandles[fh_i] = res;
-
-    return fh_i + 3; // +3 as filehandles 0-2 are stdin/out/err
+    return fd + 3; // +3 as filehandles 0-2 are stdin/out/err
 }
 
 extern "C" int PREFIX(_close)(FILEHANDLE fh) {
     if (fh < 3) return 0;
+    if (!FileDescriptors::in_use(fh - 3)) return -1;
 
-    FileHandle* fhc = filehandles[fh-3];
-    filehandles[fh-3] = NULL;
+    // wait for calls in progress on the descriptor
+    mbed_filehandle_lock(fh - 3);
+    FileHandle* fhc = FileDescriptors::release(fh - 3);
+    mbed_filehandle_unlock(fh - 3);
     if (fhc == NULL) return -1;
 
     return fhc->close();
@@ -206,10 +325,11 @@ extern "C" int PREFIX(_write)(FILEHANDLE fh, const unsigned char *buffer, unsign
 #endif
         n = length;
     } else {
-        FileHandle* fhc = filehandles[fh-3];
+        FileHandle* fhc = lock_filehandle(fh);
         if (fhc == NULL) return -1;
 
         n = fhc->write(buffer, length);
+        unlock_filehandle(fh);
     }
 #ifdef __ARMCC_VERSION
     return length-n;
@@ -232,10 +352,11 @@ extern "C" int PREFIX(_read)(FILEHANDLE fh, unsigned char *buffer, unsigned int
 #endif
         n = 1;
     } else {
-        FileHandle* fhc = filehandles[fh-3];
+        FileHandle* fhc = lock_filehandle(fh);
         if (fhc == NULL) return -1;
 
         n = fhc->read(buffer, length);
+        unlock_filehandle(fh);
     }
 #ifdef __ARMCC_VERSION
     return length-n;
@@ -253,10 +374,12 @@ extern "C" int _isatty(FILEHANDLE fh)
     /* stdin, stdout and stderr should be tty */
     if (fh < 3) return 1;
 
-    FileHandle* fhc = filehandles[fh-3];
+    FileHandle* fhc = lock_filehandle(fh);
     if (fhc == NULL) return -1;
 
-    return fhc->isatty();
+    int res = fhc->isatty();
+    unlock_filehandle(fh);
+    return res;
 }
 
 extern "C"
@@ -270,37 +393,135 @@ int _lseek(FILEHANDLE fh, int offset, int whence)
 {
     if (fh < 3) return 0;
 
-    FileHandle* fhc = filehandles[fh-3];
+    FileHandle* fhc = lock_filehandle(fh);
     if (fhc == NULL) return -1;
 
 #if defined(__ARMCC_VERSION)
-    return fhc->lseek(position, SEEK_SET);
+    int res = fhc->lseek(position, SEEK_SET);
 #else
-    return fhc->lseek(offset, whence);
+    int res = fhc->lseek(offset, whence);
 #endif
+    unlock_filehandle(fh);
+    return res;
 }
 
 #ifdef __ARMCC_VERSION
 extern "C" int PREFIX(_ensure)(FILEHANDLE fh) {
     if (fh < 3) return 0;
 
-    FileHandle* fhc = filehandles[fh-3];
+    FileHandle* fhc = lock_filehandle(fh);
     if (fhc == NULL) return -1;
 
-    return fhc->fsync();
+    int res = fhc->fsync();
+    unlock_filehandle(fh);
+    return res;
 }
 
 extern "C" long PREFIX(_flen)(FILEHANDLE fh) {
     if (fh < 3) return 0;
 
-    FileHandle* fhc = filehandles[fh-3];
+    FileHandle* fhc = lock_filehandle(fh);
     if (fhc == NULL) return -1;
 
-    return fhc->flen();
+    long res = fhc->flen();
+    unlock_filehandle(fh);
+    return res;
 }
 #endif
 
 
+extern "C" size_t mbed_fwrite(const void *ptr, size_t size, size_t count, FILE *stream) {
+#if defined(TOOLCHAIN_GCC)
+    // newlib copies through the FILE buffer, and FatFs has its own sector
+    // buffer behind the FileHandle, so large blocks skip the first one
+    size_t length = size * count;
+    int fh = fileno(stream);
+    if ((length >= MBED_FWRITE_DIRECT_MIN) && (fh >= 3) && (fflush(stream) == 0)) {
+        FileHandle *fhc = lock_filehandle(fh);
+        if (fhc != NULL) {
+            if (!fhc->isatty()) {
+                ssize_t n = fhc->write(ptr, length);
+                off_t pos = fhc->lseek(0, SEEK_CUR);
+                unlock_filehandle(fh);
+                // the offset newlib may have cached is from before the write,
+                // SEEK_CUR would move back there
+                if (pos >= 0) {
+                    fseek(stream, pos, SEEK_SET);
+                }
+                return (n < 0) ? 0 : (size_t)n / size;
+            }
+            unlock_filehandle(fh);
+        }
+    }
+#endif
+    return fwrite(ptr, size, count, stream);
+}
+
+#if defined(TOOLCHAIN_GCC_NATIVE)
+/* The FileHandles are opened as glibc custom streams on top of the
+ * descriptors above, the cookie is the descriptor.
+ */
+static ssize_t cookie_read(void *cookie, char *buffer, size_t length) {
+    return PREFIX(_read)((FILEHANDLE)(intptr_t)cookie, (unsigned char*)buffer, length, 0);
+}
+
+static ssize_t cookie_write(void *cookie, const char *buffer, size_t length) {
+    int n = PREFIX(_write)((FILEHANDLE)(intptr_t)cookie, (const unsigned char*)buffer, length, 0);
+    return (n < 0) ? 0 : n;
+}
+
+static int cookie_seek(void *cookie, off64_t *position, int whence) {
+    int res = _lseek((FILEHANDLE)(intptr_t)cookie, *position, whence);
+    if (res < 0) return -1;
+    *position = res;
+    return 0;
+}
+
+static int cookie_close(void *cookie) {
+    return PREFIX(_close)((FILEHANDLE)(intptr_t)cookie);
+}
+
+static int mode_to_posix(const char *mode) {
+    int posix;
+    switch (mode[0]) {
+        case 'r': posix = O_RDONLY; break;
+        case 'w': posix = O_WRONLY | O_CREAT | O_TRUNC; break;
+        case 'a': posix = O_WRONLY | O_CREAT | O_APPEND; break;
+        default:  return -1;
+    }
+    if (std::strchr(mode, '+') != NULL) {
+        posix = (posix & ~O_WRONLY) | O_RDWR;
+    }
+    return posix;
+}
+
+extern "C" FILE *__real_fopen(const char *name, const char *mode);
+
+extern "C" FILE *__wrap_fopen(const char *name, const char *mode) {
+    if ((name[0] != ':') && !FilePath(name).exists()) {
+        return __real_fopen(name, mode);
+    }
+
+    int openmode = mode_to_posix(mode);
+    if (openmode < 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+    FILEHANDLE fh = PREFIX(_open)(name, openmode);
+    if (fh < 0) return NULL;
+
+    cookie_io_functions_t functions = {cookie_read, cookie_write, cookie_seek, cookie_close};
+    FILE *file = fopencookie((void*)(intptr_t)fh, mode, functions);
+    if (file == NULL) {
+        PREFIX(_close)(fh);
+    }
+    return file;
+}
+
+extern "C" int __real_remove(const char *path);
+extern "C" int __real_rename(const char *oldname, const char *newname);
+#endif
+
 #if !defined(__ARMCC_VERSION) && !defined(__ICCARM__)
 extern "C" int _fstat(int fd, struct stat *st) {
     if ((STDOUT_FILENO == fd) || (STDERR_FILENO == fd) || (STDIN_FILENO == fd)) {
@@ -314,19 +535,25 @@ extern "C" int _fstat(int fd, struct stat *st) {
 #endif
 
 namespace std {
-extern "C" int remove(const char *path) {
+extern "C" int WRAPPED(remove)(const char *path) {
     FilePath fp(path);
     FileSystemLike *fs = fp.fileSystem();
+#if defined(TOOLCHAIN_GCC_NATIVE)
+    if (!fp.exists()) return __real_remove(path);
+#endif
     if (fs == NULL) return -1;
 
     return fs->remove(fp.fileName());
 }
 
-extern "C" int rename(const char *oldname, const char *newname) {
+extern "C" int WRAPPED(rename)(const char *oldname, const char *newname) {
     FilePath fpOld(oldname);
     FilePath fpNew(newname);
     FileSystemLike *fsOld = fpOld.fileSystem();
     FileSystemLike *fsNew = fpNew.fileSystem();
+#if defined(TOOLCHAIN_GCC_NATIVE)
+    if (!fpOld.exists() && !fpNew.exists()) return __real_rename(oldname, newname);
+#endif
 
     /* rename only if both files are on the same FS */
     if (fsOld != fsNew || fsOld == NULL) return -1;
@@ -334,6 +561,7 @@ extern "C" int rename(const char *oldname, const char *newname) {
     return fsOld->rename(fpOld.fileName(), fpNew.fileName());
 }
 
+#if !defined(TOOLCHAIN_GCC_NATIVE)
 extern "C" char *tmpnam(char *s) {
     return NULL;
 }
@@ -341,6 +569,7 @@ extern "C" char *tmpnam(char *s) {
 extern "C" FILE *tmpfile() {
     return NULL;
 }
+#endif
 } // namespace std
 
 #ifdef __ARMCC_VERSION
@@ -349,6 +578,10 @@ extern "C" char *_sys_command_string(char *cmd, int len) {
 }
 #endif
 
+#if !defined(TOOLCHAIN_GCC_NATIVE)
+/* On the host these would replace the glibc functions of the same name
+ * with incompatible types, the DirHandles are used directly there.
+ */
 extern "C" DIR *opendir(const char *path) {
     /* root dir is FileSystemLike */
     if (path[0] == '/' && path[1] == 0) {
@@ -389,6 +622,7 @@ extern "C" int mkdir(const char *path, mode_t mode) {
 
     return fs->mkdir(fp.fileName(), mode);
 }
+#endif
 
 #if defined(TOOLCHAIN_GCC)
 /* prevents the exception handling name demangling code getting pulled in */
@@ -480,3 +714,69 @@ extern "C" caddr_t _sbrk(int incr) {
     return (caddr_t) prev_heap;
 }
 #endif
+
+#if defined(MBED_HEAP_TLSF) && !defined(TOOLCHAIN_GCC_NATIVE)
+// Route every allocation to the TLSF heap. The definitions live in this
+// object, which the tools link on its own, so they win over the library
+// ones; the newlib reentrant entry points catch its internal allocations.
+#include "mbed_alloc.h"
+#include "error.h"
+
+extern "C" void *malloc(size_t size) {
+    return mbed_alloc_malloc(size);
+}
+
+extern "C" void free(void *ptr) {
+    mbed_alloc_free(ptr);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+    return mbed_alloc_realloc(ptr, size);
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+    return mbed_alloc_calloc(count, size);
+}
+
+#if defined(TOOLCHAIN_GCC)
+extern "C" void *_malloc_r(struct _reent *r, size_t size) {
+    return mbed_alloc_malloc(size);
+}
+
+extern "C" void _free_r(struct _reent *r, void *ptr) {
+    mbed_alloc_free(ptr);
+}
+
+extern "C" void *_realloc_r(struct _reent *r, void *ptr, size_t size) {
+    return mbed_alloc_realloc(ptr, size);
+}
+
+extern "C" void *_calloc_r(struct _reent *r, size_t count, size_t size) {
+    return mbed_alloc_calloc(count, size);
+}
+#endif
+
+void *operator new(size_t size) {
+    void *ptr = mbed_alloc_malloc(size);
+    if (ptr == NULL) {
+        error("Operator new out of memory\r\n");
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size) {
+    void *ptr = mbed_alloc_malloc(size);
+    if (ptr == NULL) {
+        error("Operator new[] out of memory\r\n");
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) {
+    mbed_alloc_free(ptr);
+}
+
+void operator delete[](void *ptr) {
+    mbed_alloc_free(ptr);
+}
+#endif
@@ -0,0 +1,254 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "ticker_api.h"
+#include "cmsis.h"
+#include "critical.h"
+#include "mbed_profile.h"
+
+/* An event comes before another one if its timestamp is earlier, taking the
+   wrap of the 32 bit counter into account */
+static inline int event_before(const ticker_event_t *a, const ticker_event_t *b) {
+    return (int)(a->timestamp - b->timestamp) < 0;
+}
+
+static inline int event_queued(const ticker_event_queue_t *queue, const ticker_event_t *obj) {
+    return (obj == queue->head) || (obj->parent != NULL);
+}
+
+/* Return the node at (1-based) position pos of the heap. The bits of pos
+   below the most significant one give the path from the root:
+   0 is left, 1 is right. */
+static ticker_event_t *event_at(ticker_event_queue_t *queue, uint32_t pos) {
+    ticker_event_t *p = queue->head;
+    uint32_t mask = 1;
+    while (mask <= (pos >> 1)) {
+        mask <<= 1;
+    }
+    while ((mask >>= 1) != 0) {
+        p = (pos & mask) ? p->right : p->left;
+    }
+    return p;
+}
+
+/* Exchange obj with its parent, keeping every link consistent */
+static void swap_with_parent(ticker_event_queue_t *queue, ticker_event_t *obj) {
+    ticker_event_t *p = obj->parent;
+    ticker_event_t *g = p->parent;
+    ticker_event_t *left = obj->left, *right = obj->right;
+
+    if (p->left == obj) {
+        obj->left = p;
+        obj->right = p->right;
+        if (obj->right != NULL) obj->right->parent = obj;
+    } else {
+        obj->right = p;
+        obj->left = p->left;
+        if (obj->left != NULL) obj->left->parent = obj;
+    }
+    p->left = left;
+    p->right = right;
+    if (left != NULL) left->parent = p;
+    if (right != NULL) right->parent = p;
+    p->parent = obj;
+
+    obj->parent = g;
+    if (g == NULL) {
+        queue->head = obj;
+    } else if (g->left == p) {
+        g->left = obj;
+    } else {
+        g->right = obj;
+    }
+}
+
+static void sift_up(ticker_event_queue_t *queue, ticker_event_t *obj) {
+    while ((obj->parent != NULL) && event_before(obj, obj->parent)) {
+        swap_with_parent(queue, obj);
+    }
+}
+
+static void sift_down(ticker_event_queue_t *queue, ticker_event_t *obj) {
+    while (1) {
+        ticker_event_t *c = obj->left;
+        if (c == NULL) {
+            return;
+        }
+        if ((obj->right != NULL) && event_before(obj->right, c)) {
+            c = obj->right;
+        }
+        if (!event_before(c, obj)) {
+            return;
+        }
+        swap_with_parent(queue, c);
+    }
+}
+
+static void queue_insert(ticker_event_queue_t *queue, ticker_event_t *obj) {
+    obj->left = obj->right = NULL;
+    queue->size++;
+    if (queue->size == 1) {
+        obj->parent = NULL;
+        queue->head = obj;
+        return;
+    }
+
+    // append as the last leaf, then restore the heap order
+    ticker_event_t *p = event_at(queue, queue->size >> 1);
+    obj->parent = p;
+    if (queue->size & 1) {
+        p->right = obj;
+    } else {
+        p->left = obj;
+    }
+    sift_up(queue, obj);
+}
+
+static void queue_remove(ticker_event_queue_t *queue, ticker_event_t *obj) {
+    // detach the last leaf
+    ticker_event_t *last = event_at(queue, queue->size);
+    queue->size--;
+    if (last->parent == NULL) {
+        queue->head = NULL;
+    } else if (last->parent->left == last) {
+        last->parent->left = NULL;
+    } else {
+        last->parent->right = NULL;
+    }
+
+    // and move it into the slot left by obj, unless obj was that leaf
+    if (last != obj) {
+        last->parent = obj->parent;
+        last->left = obj->left;
+        last->right = obj->right;
+        if (last->left != NULL) last->left->parent = last;
+        if (last->right != NULL) last->right->parent = last;
+        if (obj->parent == NULL) {
+            queue->head = last;
+        } else if (obj->parent->left == obj) {
+            obj->parent->left = last;
+        } else {
+            obj->parent->right = last;
+        }
+
+        if ((last->parent != NULL) && event_before(last, last->parent)) {
+            sift_up(queue, last);
+        } else {
+            sift_down(queue, last);
+        }
+    }
+
+    obj->parent = obj->left = obj->right = NULL;
+}
+
+us_timestamp_t ticker_read64(const ticker_data_t *const data) {
+    ticker_event_queue_t *queue = data->queue;
+    core_util_critical_section_enter();
+
+    uint32_t now = data->interface->read();
+    if (now < queue->last_read) {
+        // the 32 bit counter wrapped since the last read
+        queue->high++;
+    }
+    queue->last_read = now;
+    us_timestamp_t time = ((us_timestamp_t)queue->high << 32) | now;
+
+    core_util_critical_section_exit();
+    return time;
+}
+
+void ticker_set_handler(const ticker_data_t *const data, ticker_event_handler handler) {
+    data->interface->init();
+
+    data->queue->event_handler = handler;
+}
+
+void ticker_irq_handler(const ticker_data_t *const data) {
+    ticker_event_queue_t *queue = data->queue;
+    MBED_PROFILE_START(ticker_irq_handler);
+    data->interface->clear_interrupt();
+
+    // keep track of the 32 bit counter wraps
+    ticker_read64(data);
+
+    /* Go through all the pending TimerEvents */
+    while (1) {
+        core_util_critical_section_enter();
+        if (queue->head == NULL) {
+            // There are no more TimerEvents left, so disable matches.
+            data->interface->disable_interrupt();
+            core_util_critical_section_exit();
+            break;
+        }
+
+        if ((int)(queue->head->timestamp - data->interface->read()) <= 0) {
+            // This event was in the past:
+            //      take it out of the queue and execute its handler
+            ticker_event_t *p = queue->head;
+            queue_remove(queue, p);
+            core_util_critical_section_exit();
+            if (queue->event_handler != NULL) {
+                queue->event_handler(p->id); // NOTE: the handler can set new events
+            }
+        } else {
+            // This event and the following ones in the queue are in the future:
+            //      set it as next interrupt and return
+            data->interface->set_interrupt(queue->head->timestamp);
+            core_util_critical_section_exit();
+            break;
+        }
+    }
+    MBED_PROFILE_STOP(ticker_irq_handler);
+}
+
+void ticker_insert_event(const ticker_data_t *const data, ticker_event_t *obj, unsigned int timestamp, uint32_t id) {
+    ticker_event_queue_t *queue = data->queue;
+    /* disable interrupts for the duration of the function */
+    core_util_critical_section_enter();
+
+    // an event can only be in the queue once
+    if (event_queued(queue, obj)) {
+        queue_remove(queue, obj);
+    }
+
+    // initialise our data
+    obj->timestamp = timestamp;
+    obj->id = id;
+
+    queue_insert(queue, obj);
+
+    /* if we became the head, the next interrupt is ours */
+    if (queue->head == obj) {
+        data->interface->set_interrupt(timestamp);
+    }
+
+    core_util_critical_section_exit();
+}
+
+void ticker_remove_event(const ticker_data_t *const data, ticker_event_t *obj) {
+    ticker_event_queue_t *queue = data->queue;
+    core_util_critical_section_enter();
+
+    if (event_queued(queue, obj)) {
+        int was_head = (queue->head == obj);
+        queue_remove(queue, obj);
+        if (was_head && (queue->head != NULL)) {
+            data->interface->set_interrupt(queue->head->timestamp);
+        }
+    }
+
+    core_util_critical_section_exit();
+}
@@ -15,100 +15,42 @@
  */
 #include <stddef.h>
 #include "us_ticker_api.h"
-#include "cmsis.h"
 
-static ticker_event_handler event_handler;
-static ticker_event_t *head = NULL;
+static ticker_event_queue_t events;
 
-void us_ticker_set_handler(ticker_event_handler handler) {
-    us_ticker_init();
+static const ticker_interface_t us_interface = {
+    .init = us_ticker_init,
+    .read = us_ticker_read,
+    .disable_interrupt = us_ticker_disable_interrupt,
+    .clear_interrupt = us_ticker_clear_interrupt,
+    .set_interrupt = us_ticker_set_interrupt,
+};
+
+static const ticker_data_t us_data = {
+    .interface = &us_interface,
+    .queue = &events,
+};
 
-    event_handler = handler;
+const ticker_data_t *get_us_ticker_data(void) {
+    return &us_data;
 }
 
-void us_ticker_irq_handler(void) {
-    us_ticker_clear_interrupt();
+us_timestamp_t us_ticker_read64(void) {
+    return ticker_read64(&us_data);
+}
 
-    /* Go through all the pending TimerEvents */
-    while (1) {
-        if (head == NULL) {
-            // There are no more TimerEvents left, so disable matches.
-            us_ticker_disable_interrupt();
-            return;
-        }
+void us_ticker_set_handler(ticker_event_handler handler) {
+    ticker_set_handler(&us_data, handler);
+}
 
-        if ((int)(head->timestamp - us_ticker_read()) <= 0) {
-            // This event was in the past:
-            //      point to the following one and execute its handler
-            ticker_event_t *p = head;
-            head = head->next;
-            if (event_handler != NULL) {
-                event_handler(p->id); // NOTE: the handler can set new events
-            }
-        } else {
-            // This event and the following ones in the list are in the future:
-            //      set it as next interrupt and return
-            us_ticker_set_interrupt(head->timestamp);
-            return;
-        }
-    }
+void us_ticker_irq_handler(void) {
+    ticker_irq_handler(&us_data);
 }
 
 void us_ticker_insert_event(ticker_event_t *obj, unsigned int timestamp, uint32_t id) {
-    /* disable interrupts for the duration of the function */
-    __disable_irq();
-
-    // initialise our data
-    obj->timestamp = timestamp;
-    obj->id = id;
-
-    /* Go through the list until we either reach the end, or find
-       an element this should come before (which is possibly the
-       head). */
-    ticker_event_t *prev = NULL, *p = head;
-    while (p != NULL) {
-        /* check if we come before p */
-        if ((int)(timestamp - p->timestamp) <= 0) {
-            break;
-        }
-        /* go to the next element */
-        prev = p;
-        p = p->next;
-    }
-    /* if prev is NULL we're at the head */
-    if (prev == NULL) {
-        head = obj;
-        us_ticker_set_interrupt(timestamp);
-    } else {
-        prev->next = obj;
-    }
-    /* if we're at the end p will be NULL, which is correct */
-    obj->next = p;
-
-    __enable_irq();
+    ticker_insert_event(&us_data, obj, timestamp, id);
 }
 
 void us_ticker_remove_event(ticker_event_t *obj) {
-    __disable_irq();
-
-    // remove this object from the list
-    if (head == obj) {
-        // first in the list, so just drop me
-        head = obj->next;
-        if (obj->next != NULL) {
-            us_ticker_set_interrupt(head->timestamp);
-        }
-    } else {
-        // find the object before me, then drop me
-        ticker_event_t* p = head;
-        while (p != NULL) {
-            if (p->next == obj) {
-                p->next = obj->next;
-                break;
-            }
-            p = p->next;
-        }
-    }
-
-    __enable_irq();
+    ticker_remove_event(&us_data, obj);
 }
@@ -30,6 +30,40 @@ void     analogin_init    (analogin_t *obj, PinName pin);
 float    analogin_read    (analogin_t *obj);
 uint16_t analogin_read_u16(analogin_t *obj);
 
+#if DEVICE_ANALOGIN_STREAM
+
+/* Sample format of a stream */
+typedef enum {
+    AnalogInFormatU16,  /* uint16_t, 0x0 - 0xFFFF as analogin_read_u16 */
+    AnalogInFormatQ15,  /* q15_t, 0x0 - 0x7FFF for the CMSIS-DSP q15 functions */
+    AnalogInFormatF32   /* float, 0.0 - 1.0 as analogin_read */
+} AnalogInFormat;
+
+/* half is 0 when the first half of the buffer is full, 1 for the second half */
+typedef void (*analogin_stream_handler)(uint32_t id, int half);
+
+/** Start timer triggered conversions into a ping-pong buffer
+ *
+ *  The channels, all on the same ADC, are converted in turn at
+ *  rate * count conversions per second, so the buffer holds frames of
+ *  count interleaved samples. length is the total number of samples in
+ *  the buffer and must be a multiple of 2 * count. The handler is called
+ *  from the ADC interrupt each time a half of the buffer has been filled,
+ *  while conversions carry on into the other half.
+ *
+ *  @returns 0 on success, -1 if the rate cannot be generated
+ */
+int  analogin_stream_start(analogin_t *channels, int count, uint32_t rate, void *buffer, int length,
+                           AnalogInFormat format, analogin_stream_handler handler, uint32_t id);
+
+/** Stop the stream, the ADC is left ready for analogin_read */
+void analogin_stream_stop(void);
+
+/** Number of conversions lost because the interrupt was serviced too late */
+uint32_t analogin_stream_overruns(void);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,36 @@ void i2c_reset        (i2c_t *obj);
 int  i2c_byte_read    (i2c_t *obj, int last);
 int  i2c_byte_write   (i2c_t *obj, int data);
 
+/* Events reported at the end of a transaction */
+#define I2C_EVENT_COMPLETE              (1 << 0)
+#define I2C_EVENT_ERROR                 (1 << 1)
+#define I2C_EVENT_ERROR_NO_SLAVE        (1 << 2)
+#define I2C_EVENT_TRANSFER_EARLY_NACK   (1 << 3)
+#define I2C_EVENT_ALL                   (I2C_EVENT_COMPLETE | I2C_EVENT_ERROR | I2C_EVENT_ERROR_NO_SLAVE | I2C_EVENT_TRANSFER_EARLY_NACK)
+
+#if DEVICE_I2C_ASYNCH
+
+typedef void (*i2c_async_handler)(uint32_t id, int event);
+
+/** Start an interrupt driven master transaction
+ *
+ *  tx_length bytes are written to the slave, then, after a repeated start,
+ *  rx_length bytes are read from it. Either part may be empty, a transaction
+ *  with neither only addresses the slave. The handler is called from the I2C
+ *  interrupt once the stop condition has been sent, the bus is idle again
+ *  when it runs so it may start the next transaction.
+ */
+void i2c_transfer_asynch(i2c_t *obj, int address, const char *tx, int tx_length,
+                         char *rx, int rx_length, i2c_async_handler handler, uint32_t id);
+
+/** Check whether the peripheral of obj has a transaction in progress */
+int  i2c_active         (i2c_t *obj);
+
+/** Stop the transaction in progress without calling its handler */
+void i2c_abort_asynch   (i2c_t *obj);
+
+#endif
+
 #if DEVICE_I2CSLAVE
 void i2c_slave_mode   (i2c_t *obj, int enable_slave);
 int  i2c_slave_receive(i2c_t *obj);
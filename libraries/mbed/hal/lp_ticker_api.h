@@ -0,0 +1,50 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_LPTICKER_API_H
+#define MBED_LPTICKER_API_H
+
+#include "device.h"
+
+#if DEVICE_LOWPOWERTIMER
+
+#include "ticker_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A ticker that keeps counting, and can wake the device, in deepsleep().
+ * It counts micro-seconds like the us_ticker, at the resolution of its
+ * clock (an RTC or low power timer), and its interrupts can come later
+ * than asked: the events are checked against the counter when they fire.
+ */
+void lp_ticker_init(void);
+uint32_t lp_ticker_read(void);
+void lp_ticker_set_interrupt(unsigned int timestamp);
+void lp_ticker_disable_interrupt(void);
+void lp_ticker_clear_interrupt(void);
+void lp_ticker_irq_handler(void);
+
+/** The lp_ticker, for the generic ticker functions */
+const ticker_data_t *get_lp_ticker_data(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
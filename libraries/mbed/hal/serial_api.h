@@ -69,6 +69,23 @@ void serial_pinout_tx(PinName tx);
 
 void serial_set_flow_control(serial_t *obj, FlowControl type, PinName rxflow, PinName txflow);
 
+#if DEVICE_SERIAL_BLOCK
+/** Copy as many characters as fit into the transmit FIFO without blocking
+ *
+ *  @returns the number of characters written
+ */
+int  serial_write_block(serial_t *obj, const char *data, int length);
+
+/** Copy up to length characters out of the receive FIFO without blocking
+ *
+ *  *overrun is set to 1 if the hardware dropped characters since the
+ *  receive status was last read, 0 otherwise.
+ *
+ *  @returns the number of characters read
+ */
+int  serial_read_block (serial_t *obj, char *data, int length, int *overrun);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,38 @@ int  spi_slave_read   (spi_t *obj);
 void spi_slave_write  (spi_t *obj, int value);
 int  spi_busy         (spi_t *obj);
 
+/* Events reported at the end of a transfer */
+#define SPI_EVENT_COMPLETE      (1 << 0)
+#define SPI_EVENT_RX_OVERFLOW   (1 << 1)
+#define SPI_EVENT_ERROR         (1 << 2)
+#define SPI_EVENT_ALL           (SPI_EVENT_COMPLETE | SPI_EVENT_RX_OVERFLOW | SPI_EVENT_ERROR)
+
+/* Value sent when a transfer has no transmit buffer */
+#define SPI_FILL_WORD           (0xFFFF)
+
+#if DEVICE_SPI_ASYNCH
+
+typedef void (*spi_async_handler)(uint32_t id, int event);
+
+/** Start an interrupt driven transfer of length words on a master
+ *
+ *  Words are 8 bits wide for frames of up to 8 bits and 16 bits wide
+ *  otherwise. tx may be NULL to send SPI_FILL_WORD and rx may be NULL
+ *  to discard the received data. The handler is called from the SPI
+ *  interrupt once the transfer has ended, the peripheral is idle again
+ *  when it runs so it may start the next transfer.
+ */
+void spi_master_transfer(spi_t *obj, const void *tx, void *rx, int length, int bits,
+                         spi_async_handler handler, uint32_t id);
+
+/** Check whether the peripheral of obj has a transfer in progress */
+int  spi_active         (spi_t *obj);
+
+/** Stop the transfer in progress without calling its handler */
+void spi_abort_asynch   (spi_t *obj);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
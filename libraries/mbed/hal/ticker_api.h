@@ -0,0 +1,84 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_TICKER_API_H
+#define MBED_TICKER_API_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Time in micro-seconds on the extended 64 bit timebase */
+typedef uint64_t us_timestamp_t;
+
+typedef void (*ticker_event_handler)(uint32_t id);
+
+/* Pending events are kept in a pointer based binary min-heap ordered by
+ * timestamp, so insertion and removal are O(log n) and the time spent with
+ * interrupts disabled is bounded by the depth of the heap.
+ * A ticker_event_t must be zero initialised before its first insertion.
+ */
+typedef struct ticker_event_s {
+    uint32_t timestamp;
+    uint32_t id;
+    struct ticker_event_s *parent;
+    struct ticker_event_s *left;
+    struct ticker_event_s *right;
+} ticker_event_t;
+
+/** The HAL functions of a ticker, counting micro-seconds on 32 bits */
+typedef struct {
+    void (*init)(void);
+    uint32_t (*read)(void);
+    void (*disable_interrupt)(void);
+    void (*clear_interrupt)(void);
+    void (*set_interrupt)(unsigned int timestamp);
+} ticker_interface_t;
+
+/** The events of a ticker, and the state of its 64 bit timebase */
+typedef struct {
+    ticker_event_handler event_handler;
+    ticker_event_t *head;
+    uint32_t size;
+    uint32_t last_read;
+    uint32_t high;
+} ticker_event_queue_t;
+
+/** A ticker: its HAL and its event queue */
+typedef struct {
+    const ticker_interface_t *interface;
+    ticker_event_queue_t *queue;
+} ticker_data_t;
+
+/* Read the ticker extended to 64 bits. The wrap of the 32 bit counter is
+ * tracked on every read (including the one done by ticker_irq_handler),
+ * so no extra interrupt is needed as long as the ticker is read at least
+ * once every 2^32 micro-seconds.
+ */
+us_timestamp_t ticker_read64(const ticker_data_t *const data);
+
+void ticker_set_handler(const ticker_data_t *const data, ticker_event_handler handler);
+void ticker_irq_handler(const ticker_data_t *const data);
+
+void ticker_insert_event(const ticker_data_t *const data, ticker_event_t *obj, unsigned int timestamp, uint32_t id);
+void ticker_remove_event(const ticker_data_t *const data, ticker_event_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
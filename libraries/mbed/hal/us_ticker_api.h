@@ -17,6 +17,7 @@
 #define MBED_US_TICKER_API_H
 
 #include <stdint.h>
+#include "ticker_api.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,14 +25,10 @@ extern "C" {
 
 uint32_t us_ticker_read(void);
 
-typedef void (*ticker_event_handler)(uint32_t id);
-void us_ticker_set_handler(ticker_event_handler handler);
+/* Read the us_ticker extended to 64 bits, see ticker_read64() */
+us_timestamp_t us_ticker_read64(void);
 
-typedef struct ticker_event_s {
-    uint32_t timestamp;
-    uint32_t id;
-    struct ticker_event_s *next;
-} ticker_event_t;
+void us_ticker_set_handler(ticker_event_handler handler);
 
 void us_ticker_init(void);
 void us_ticker_set_interrupt(unsigned int timestamp);
@@ -42,6 +39,9 @@ void us_ticker_irq_handler(void);
 void us_ticker_insert_event(ticker_event_t *obj, unsigned int timestamp, uint32_t id);
 void us_ticker_remove_event(ticker_event_t *obj);
 
+/** The us_ticker, for the generic ticker functions */
+const ticker_data_t *get_us_ticker_data(void);
+
 #ifdef __cplusplus
 }
 #endif
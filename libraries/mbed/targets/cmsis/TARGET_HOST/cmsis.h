@@ -0,0 +1,13 @@
+/* mbed Microcontroller Library - CMSIS
+ * Copyright (C) 2009-2014 ARM Limited. All rights reserved.
+ *
+ * A generic CMSIS include header, pulling in the host core model
+ */
+
+#ifndef MBED_CMSIS_H
+#define MBED_CMSIS_H
+
+#include "core_host.h"
+#include "cmsis_nvic.h"
+
+#endif
@@ -0,0 +1,16 @@
+/* mbed Microcontroller Library - cmsis_nvic for the host
+ * Copyright (c) 2009-2014 ARM Limited. All rights reserved.
+ *
+ * CMSIS-style functionality to support dynamic vectors
+ */
+#include "cmsis_nvic.h"
+
+static volatile uint32_t vectors[NVIC_NUM_VECTORS];
+
+void NVIC_SetVector(IRQn_Type IRQn, uint32_t vector) {
+    vectors[IRQn + NVIC_USER_IRQ_OFFSET] = vector;
+}
+
+uint32_t NVIC_GetVector(IRQn_Type IRQn) {
+    return vectors[IRQn + NVIC_USER_IRQ_OFFSET];
+}
@@ -0,0 +1,164 @@
+/* mbed Microcontroller Library - core_host
+ * Copyright (c) 2009-2014 ARM Limited. All rights reserved.
+ *
+ * Model of the core functions and the NVIC on a POSIX host
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include "cmsis.h"
+
+typedef void (*vector_t)(void);
+
+/* Taken by whoever has interrupts masked, and by the interrupt thread
+   while a handler runs */
+static pthread_mutex_t mask_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t primask;
+static __thread uint32_t ipsr;
+
+/* Protects the NVIC state below */
+static pthread_mutex_t nvic_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t nvic_pending = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t nvic_handled = PTHREAD_COND_INITIALIZER;
+static uint32_t enabled;
+static uint32_t pending;
+static uint32_t handled;
+static int interrupt_thread_started;
+
+void __disable_irq(void) {
+    if (!primask) {
+        pthread_mutex_lock(&mask_lock);
+        primask = 1;
+    }
+}
+
+void __enable_irq(void) {
+    if (primask) {
+        primask = 0;
+        pthread_mutex_unlock(&mask_lock);
+    }
+}
+
+uint32_t __get_PRIMASK(void) {
+    return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask) {
+    if (priMask & 1) {
+        __disable_irq();
+    } else {
+        __enable_irq();
+    }
+}
+
+uint32_t __get_IPSR(void) {
+    return ipsr;
+}
+
+static void *interrupt_thread(void *arg) {
+    pthread_mutex_lock(&nvic_lock);
+    while (1) {
+        while ((pending & enabled) == 0) {
+            pthread_cond_wait(&nvic_pending, &nvic_lock);
+        }
+        // the interrupt stays pending until it is unmasked, which is what
+        // ends a __WFI() called with interrupts masked
+        pthread_mutex_unlock(&nvic_lock);
+        __disable_irq();
+        pthread_mutex_lock(&nvic_lock);
+        if ((pending & enabled) == 0) {
+            // cleared or disabled meanwhile
+            pthread_mutex_unlock(&nvic_lock);
+            __enable_irq();
+            pthread_mutex_lock(&nvic_lock);
+            continue;
+        }
+        // the lowest number has the highest priority
+        uint32_t active = __builtin_ctz(pending & enabled);
+        pending &= ~(1UL << active);
+        pthread_mutex_unlock(&nvic_lock);
+
+        vector_t handler = (vector_t)NVIC_GetVector((IRQn_Type)active);
+        if (handler != NULL) {
+            ipsr = active + NVIC_USER_IRQ_OFFSET;
+            handler();
+            ipsr = 0;
+        }
+        __enable_irq();
+
+        pthread_mutex_lock(&nvic_lock);
+        handled++;
+        pthread_cond_broadcast(&nvic_handled);
+    }
+    return NULL;
+}
+
+// Called with nvic_lock held
+static void start_interrupt_thread(void) {
+    if (!interrupt_thread_started) {
+        pthread_t thread;
+        interrupt_thread_started = 1;
+        pthread_create(&thread, NULL, interrupt_thread, NULL);
+        pthread_detach(thread);
+    }
+}
+
+void __WFI(void) {
+    pthread_mutex_lock(&nvic_lock);
+    // a pending interrupt wakes the core up even if it is masked
+    uint32_t count = handled;
+    while ((handled == count) && ((pending & enabled) == 0)) {
+        pthread_cond_wait(&nvic_handled, &nvic_lock);
+    }
+    pthread_mutex_unlock(&nvic_lock);
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    start_interrupt_thread();
+    enabled |= 1UL << IRQn;
+    if (pending & enabled) {
+        pthread_cond_signal(&nvic_pending);
+        pthread_cond_broadcast(&nvic_handled);
+    }
+    pthread_mutex_unlock(&nvic_lock);
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    enabled &= ~(1UL << IRQn);
+    pthread_mutex_unlock(&nvic_lock);
+}
+
+uint32_t NVIC_GetEnableIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    uint32_t result = (enabled >> IRQn) & 1;
+    pthread_mutex_unlock(&nvic_lock);
+    return result;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    pending |= 1UL << IRQn;
+    if (pending & enabled) {
+        pthread_cond_signal(&nvic_pending);
+        pthread_cond_broadcast(&nvic_handled);
+    }
+    pthread_mutex_unlock(&nvic_lock);
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    pending &= ~(1UL << IRQn);
+    pthread_mutex_unlock(&nvic_lock);
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn) {
+    pthread_mutex_lock(&nvic_lock);
+    uint32_t result = (pending >> IRQn) & 1;
+    pthread_mutex_unlock(&nvic_lock);
+    return result;
+}
+
+void NVIC_SystemReset(void) {
+    exit(0);
+}
@@ -0,0 +1,69 @@
+/* mbed Microcontroller Library - core_host
+ * Copyright (c) 2009-2014 ARM Limited. All rights reserved.
+ *
+ * Model of the core functions and the NVIC on a POSIX host
+ *
+ * Interrupt handlers run one at a time on an interrupt thread, in the
+ * order of their IRQ numbers. The peripheral models raise interrupts with
+ * NVIC_SetPendingIRQ() from their own threads. Masking interrupts takes a
+ * lock that the interrupt thread holds while a handler runs, so code in a
+ * critical section never runs concurrently with a handler.
+ */
+
+#ifndef MBED_CORE_HOST_H
+#define MBED_CORE_HOST_H
+
+#include <stdint.h>
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+typedef enum IRQn {
+    TIMER0_IRQn = 0,
+    UART0_IRQn,
+    UART1_IRQn,
+    UART2_IRQn,
+    EINT_IRQn,
+    SWI0_IRQn,          /* not used by the HAL, free for the application */
+    SWI1_IRQn,
+    LPTIMER0_IRQn,
+} IRQn_Type;
+
+#define HOST_IRQ_COUNT  8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+
+/* Exception number of the running handler, 0 in thread mode */
+uint32_t __get_IPSR(void);
+
+/* Wait until an interrupt was handled or one is pending */
+void __WFI(void);
+
+#define __NOP()     __asm__ volatile ("nop")
+#define __DMB()     __sync_synchronize()
+#define __DSB()     __sync_synchronize()
+#define __ISB()     __sync_synchronize()
+
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetEnableIRQ(IRQn_Type IRQn);
+void NVIC_SetPendingIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn);
+
+/* Terminates the process */
+void NVIC_SystemReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -47,6 +47,8 @@
 
 #define DEVICE_SLEEP            1
 
+#define DEVICE_LOWPOWERTIMER    1
+
 #define DEVICE_DEBUG_AWARENESS  0
 
 #define DEVICE_STDIO_MESSAGES   1
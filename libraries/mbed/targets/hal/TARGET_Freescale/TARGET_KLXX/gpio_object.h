@@ -45,6 +45,33 @@ static inline int gpio_read(gpio_t *obj) {
     return ((*obj->reg_in & obj->mask) ? 1 : 0);
 }
 
+/* Register level access for the FastIO templates. With a constant pin the
+ * port and bit are integral constant expressions, so the accesses below
+ * fold into single stores to constant addresses on the fast GPIO port.
+ */
+#define GPIO_FAST_IO            1
+#define GPIO_FAST_PORT(pin)     (FPTA_BASE + ((uint32_t)(pin) >> PORT_SHIFT) * 0x40)
+#define GPIO_FAST_BIT(pin)      (((uint32_t)(pin) & 0x7F) >> 2)
+
+static inline void gpio_fast_write(uint32_t port, uint32_t set, uint32_t clr) {
+    if (set)
+        ((FGPIO_Type*)port)->PSOR = set;
+    if (clr)
+        ((FGPIO_Type*)port)->PCOR = clr;
+}
+
+static inline uint32_t gpio_fast_read(uint32_t port) {
+    return ((FGPIO_Type*)port)->PDIR;
+}
+
+static inline uint32_t gpio_fast_output(uint32_t port) {
+    return ((FGPIO_Type*)port)->PDOR;
+}
+
+static inline void gpio_fast_toggle(uint32_t port, uint32_t mask) {
+    ((FGPIO_Type*)port)->PTOR = mask;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,105 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lp_ticker_api.h"
+
+#if DEVICE_LOWPOWERTIMER
+
+#include "rtc_api.h"
+#include "cmsis.h"
+
+/******************************************************************************
+ * Low power ticker
+ *
+ * The LPTMR already schedules the us_ticker events, so the lp_ticker is built
+ * on the RTC, which keeps counting in all power modes. The counter combines
+ * the seconds register and the 32768Hz prescaler. The alarm only compares
+ * seconds: an event fires on the first second boundary at or after its
+ * timestamp, up to 1s late.
+ *
+ * Writing the time with set_time() moves the lp_ticker counter as well.
+ ******************************************************************************/
+static int lp_ticker_inited = 0;
+
+static void rtc_isr(void) {
+    lp_ticker_irq_handler();
+}
+
+void lp_ticker_init(void) {
+    if (lp_ticker_inited) return;
+    lp_ticker_inited = 1;
+
+    if (!rtc_isenabled()) {
+        rtc_init();
+    }
+
+    RTC->IER &= ~RTC_IER_TAIE_MASK;
+
+    NVIC_SetVector(RTC_IRQn, (uint32_t)rtc_isr);
+    NVIC_EnableIRQ(RTC_IRQn);
+}
+
+static uint32_t read_seconds(uint32_t *prescaler) {
+    // TPR carries into TSR, read again until both belong to the same second
+    uint32_t seconds, tpr;
+    do {
+        seconds = RTC->TSR;
+        tpr = RTC->TPR;
+    } while (seconds != RTC->TSR);
+
+    *prescaler = tpr & 0x7FFF;
+    return seconds;
+}
+
+uint32_t lp_ticker_read() {
+    if (!lp_ticker_inited)
+        lp_ticker_init();
+
+    uint32_t prescaler;
+    uint32_t seconds = read_seconds(&prescaler);
+
+    // 1000000 / 32768 = 15625 / 512
+    return seconds * 1000000u + ((prescaler * 15625u) >> 9);
+}
+
+void lp_ticker_set_interrupt(unsigned int timestamp) {
+    uint32_t prescaler;
+    uint32_t seconds = read_seconds(&prescaler);
+    uint32_t now = seconds * 1000000u + ((prescaler * 15625u) >> 9);
+
+    int delta = (int)(timestamp - now);
+    if (delta <= 0) {
+        // This event was in the past
+        NVIC_SetPendingIRQ(RTC_IRQn);
+        return;
+    }
+
+    // The alarm flag is set when TSR increments past TAR
+    uint32_t boundaries = (((prescaler * 15625u) >> 9) + (uint32_t)delta + 999999u) / 1000000u;
+    RTC->TAR = seconds + boundaries - 1;
+    RTC->IER |= RTC_IER_TAIE_MASK;
+}
+
+void lp_ticker_disable_interrupt(void) {
+    RTC->IER &= ~RTC_IER_TAIE_MASK;
+}
+
+void lp_ticker_clear_interrupt(void) {
+    // Writing TAR clears the alarm flag
+    RTC->TAR = RTC->TAR;
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+}
+
+#endif
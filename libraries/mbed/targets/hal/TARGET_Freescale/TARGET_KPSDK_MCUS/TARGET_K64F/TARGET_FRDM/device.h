@@ -23,6 +23,7 @@
 #define DEVICE_INTERRUPTIN      1
 
 #define DEVICE_ANALOGIN         1
+#define DEVICE_ANALOGIN_STREAM  1
 #define DEVICE_ANALOGOUT        1
 
 #define DEVICE_SERIAL           1
@@ -32,6 +33,7 @@
 
 #define DEVICE_SPI              1
 #define DEVICE_SPISLAVE         1
+#define DEVICE_SPI_ASYNCH       1
 
 #define DEVICE_CAN              0
 
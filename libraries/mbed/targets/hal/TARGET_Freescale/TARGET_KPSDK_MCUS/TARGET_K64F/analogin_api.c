@@ -72,4 +72,145 @@ float analogin_read(analogin_t *obj) {
     return (float)value * (1.0f / (float)0xFFFF);
 }
 
+#if DEVICE_ANALOGIN_STREAM
+
+// The PDB paces the conversions, its channel n pre-trigger A starts a
+// conversion on ADCn in hardware trigger mode. The result is collected
+// from the conversion complete interrupt, which also selects the next
+// channel.
+
+static struct {
+    uint8_t channels[8];
+    int count;
+    int channel;
+    uint32_t instance;
+    ADC_Type *adc;
+    void *buffer;
+    int length;
+    int pos;
+    AnalogInFormat format;
+    analogin_stream_handler handler;
+    uint32_t id;
+    uint32_t overruns;
+    int active;
+} stream;
+
+static void analogin_stream_irq(void) {
+    // reading R[0] clears COCO and the interrupt
+    uint32_t value = stream.adc->R[0] & 0xFFFF;
+
+    if (PDB0->CH[stream.instance].S & PDB_S_ERR(1)) {
+        // sequence error, the pre-trigger fired before the result was read
+        PDB0->CH[stream.instance].S &= ~PDB_S_ERR_MASK;
+        stream.overruns++;
+    }
+
+    if (stream.count > 1) {
+        if (++stream.channel == stream.count)
+            stream.channel = 0;
+    }
+    stream.adc->SC1[0] = ADC_SC1_AIEN_MASK | ADC_SC1_ADCH(stream.channels[stream.channel]);
+
+    switch (stream.format) {
+        case AnalogInFormatU16:
+            ((uint16_t*)stream.buffer)[stream.pos] = value;
+            break;
+        case AnalogInFormatQ15:
+            ((int16_t*)stream.buffer)[stream.pos] = value >> 1;
+            break;
+        case AnalogInFormatF32:
+            ((float*)stream.buffer)[stream.pos] = (float)value * (1.0f / (float)0xFFFF);
+            break;
+    }
+
+    if (++stream.pos == stream.length / 2) {
+        stream.handler(stream.id, 0);
+    } else if (stream.pos == stream.length) {
+        stream.pos = 0;
+        stream.handler(stream.id, 1);
+    }
+}
+
+int analogin_stream_start(analogin_t *channels, int count, uint32_t rate, void *buffer, int length,
+                          AnalogInFormat format, analogin_stream_handler handler, uint32_t id) {
+    int i;
+    uint32_t conversions = rate * count;
+    uint32_t instance = channels[0].adc >> ADC_INSTANCE_SHIFT;
+
+    if ((count < 1) || (count > 8) || (conversions == 0) || (length % (2 * count)))
+        return -1;
+    for (i = 1; i < count; i++) {
+        if ((channels[i].adc >> ADC_INSTANCE_SHIFT) != instance)
+            return -1;
+    }
+
+    // find the smallest PDB prescaler giving a 16 bit modulus
+    uint32_t bus_clock;
+    clock_manager_get_frequency(kBusClock, &bus_clock);
+    uint32_t prescaler;
+    uint32_t modulus = 0;
+    for (prescaler = 0; prescaler < 8; prescaler++) {
+        modulus = (bus_clock >> prescaler) / conversions;
+        if (modulus <= 0x10000)
+            break;
+    }
+    if ((prescaler == 8) || (modulus < 2))
+        return -1;
+
+    analogin_stream_stop();
+
+    for (i = 0; i < count; i++)
+        stream.channels[i] = channels[i].adc & 0xF;
+    stream.count = count;
+    stream.channel = 0;
+    stream.instance = instance;
+    stream.adc = instance ? ADC1 : ADC0;
+    stream.buffer = buffer;
+    stream.length = length;
+    stream.pos = 0;
+    stream.format = format;
+    stream.handler = handler;
+    stream.id = id;
+    stream.overruns = 0;
+    stream.active = 1;
+
+    // one conversion per trigger, without the averaging used by analogin_read
+    adc_hal_configure_hw_average(instance, false);
+    adc_hal_configure_hw_trigger(instance, true);
+    stream.adc->SC1[0] = ADC_SC1_AIEN_MASK | ADC_SC1_ADCH(stream.channels[0]);
+
+    SIM->SCGC6 |= SIM_SCGC6_PDB_MASK;
+    PDB0->SC = PDB_SC_PDBEN_MASK | PDB_SC_CONT_MASK | PDB_SC_TRGSEL(15) | PDB_SC_PRESCALER(prescaler);
+    PDB0->MOD = modulus - 1;
+    PDB0->IDLY = 0;
+    PDB0->CH[instance].DLY[0] = 0;
+    PDB0->CH[instance].C1 = PDB_C1_EN(1) | PDB_C1_TOS(1);
+    PDB0->SC |= PDB_SC_LDOK_MASK;
+
+    IRQn_Type irq_n = instance ? ADC1_IRQn : ADC0_IRQn;
+    NVIC_SetVector(irq_n, (uint32_t)&analogin_stream_irq);
+    NVIC_EnableIRQ(irq_n);
+
+    PDB0->SC |= PDB_SC_SWTRIG_MASK;
+    return 0;
+}
+
+void analogin_stream_stop(void) {
+    if (!stream.active)
+        return;
+    stream.active = 0;
+
+    PDB0->SC = 0;
+    NVIC_DisableIRQ(stream.instance ? ADC1_IRQn : ADC0_IRQn);
+    stream.adc->SC1[0] = ADC_SC1_ADCH(0x1F);    // module disabled
+    adc_hal_configure_hw_trigger(stream.instance, false);
+    adc_hal_configure_hw_average(stream.instance, true);
+}
+
+uint32_t analogin_stream_overruns(void) {
+    return stream.overruns;
+}
+
+#endif
+
 #endif
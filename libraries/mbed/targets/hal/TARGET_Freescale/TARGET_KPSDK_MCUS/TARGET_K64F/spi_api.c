@@ -142,4 +142,127 @@ void spi_slave_write(spi_t *obj, int value) {
     dspi_hal_write_data_slave_mode(obj->instance, (uint32_t)value);
 }
 
+#if DEVICE_SPI_ASYNCH
+
+typedef struct {
+    uint32_t instance;
+    const uint8_t *tx;
+    uint8_t *rx;
+    int width;
+    int left;
+    spi_async_handler handler;
+    uint32_t id;
+} spi_transfer_t;
+
+static spi_transfer_t spi_transfers[3];
+
+// Keep one word in flight and send the next one from the receive FIFO
+// drain request of the previous one
+static void spi_transfer_send(spi_transfer_t *t) {
+    int value = SPI_FILL_WORD;
+    if (t->tx) {
+        value = (t->width == 2) ? *(const uint16_t*)t->tx : *t->tx;
+        t->tx += t->width;
+    }
+    dspi_command_config_t command = {0};
+    command.isEndOfQueue = true;
+    command.isChipSelectContinuous = 0;
+    dspi_hal_write_data_master_mode(t->instance, &command, (uint16_t)value);
+    dspi_hal_clear_status_flag(t->instance, kDspiTxFifoFillRequest);
+}
+
+static void spi_transfer_end(spi_transfer_t *t, int event) {
+    spi_async_handler handler = t->handler;
+    dspi_hal_configure_interrupt(t->instance, kDspiRxFifoDrainRequest, false);
+    dspi_hal_configure_interrupt(t->instance, kDspiRxFifoOverflow, false);
+    t->handler = 0;
+    handler(t->id, event);
+}
+
+static void spi_transfer_irq(spi_transfer_t *t) {
+    if (t->handler == 0)
+        return;
+    if (dspi_hal_get_status_flag(t->instance, kDspiRxFifoOverflow)) {
+        dspi_hal_clear_status_flag(t->instance, kDspiRxFifoOverflow);
+        spi_transfer_end(t, SPI_EVENT_RX_OVERFLOW);
+        return;
+    }
+    if (!dspi_hal_get_status_flag(t->instance, kDspiRxFifoDrainRequest))
+        return;
+    dspi_hal_clear_status_flag(t->instance, kDspiRxFifoDrainRequest);
+    int value = dspi_hal_read_data(t->instance);
+    if (t->rx) {
+        if (t->width == 2) {
+            *(uint16_t*)t->rx = value;
+        } else {
+            *t->rx = value;
+        }
+        t->rx += t->width;
+    }
+    if (--t->left == 0) {
+        spi_transfer_end(t, SPI_EVENT_COMPLETE);
+    } else {
+        spi_transfer_send(t);
+    }
+}
+
+static void spi0_irq(void) {spi_transfer_irq(&spi_transfers[0]);}
+static void spi1_irq(void) {spi_transfer_irq(&spi_transfers[1]);}
+static void spi2_irq(void) {spi_transfer_irq(&spi_transfers[2]);}
+
+void spi_master_transfer(spi_t *obj, const void *tx, void *rx, int length, int bits,
+                         spi_async_handler handler, uint32_t id) {
+    spi_transfer_t *t = &spi_transfers[obj->instance];
+    IRQn_Type irq_n = (IRQn_Type)0;
+    uint32_t vector = 0;
+
+    switch (obj->instance) {
+        case 0: irq_n = SPI0_IRQn; vector = (uint32_t)&spi0_irq; break;
+        case 1: irq_n = SPI1_IRQn; vector = (uint32_t)&spi1_irq; break;
+        case 2: irq_n = SPI2_IRQn; vector = (uint32_t)&spi2_irq; break;
+    }
+
+    if (length <= 0) {
+        handler(id, SPI_EVENT_COMPLETE);
+        return;
+    }
+
+    // drop anything left over from a slave or an aborted transfer
+    dspi_hal_flush_fifos(obj->instance, true, true);
+    dspi_hal_clear_status_flag(obj->instance, kDspiRxFifoDrainRequest);
+    dspi_hal_clear_status_flag(obj->instance, kDspiRxFifoOverflow);
+
+    t->instance = obj->instance;
+    t->tx = (const uint8_t*)tx;
+    t->rx = (uint8_t*)rx;
+    t->width = (bits > 8) ? 2 : 1;
+    t->left = length;
+    t->id = id;
+    t->handler = handler;
+
+    NVIC_SetVector(irq_n, vector);
+    NVIC_EnableIRQ(irq_n);
+
+    while (!spi_writeable(obj));
+    spi_transfer_send(t);
+    dspi_hal_configure_interrupt(obj->instance, kDspiRxFifoOverflow, true);
+    dspi_hal_configure_interrupt(obj->instance, kDspiRxFifoDrainRequest, true);
+}
+
+int spi_active(spi_t *obj) {
+    return spi_transfers[obj->instance].handler != 0;
+}
+
+void spi_abort_asynch(spi_t *obj) {
+    dspi_hal_configure_interrupt(obj->instance, kDspiRxFifoDrainRequest, false);
+    dspi_hal_configure_interrupt(obj->instance, kDspiRxFifoOverflow, false);
+    spi_transfers[obj->instance].handler = 0;
+    while (dspi_hal_get_status_flag(obj->instance, kDspiTxAndRxStatus) &&
+           !dspi_hal_get_status_flag(obj->instance, kDspiRxFifoDrainRequest));
+    dspi_hal_flush_fifos(obj->instance, true, true);
+    dspi_hal_clear_status_flag(obj->instance, kDspiRxFifoDrainRequest);
+}
+
+#endif
+
 #endif
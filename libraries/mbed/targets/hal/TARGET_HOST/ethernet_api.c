@@ -0,0 +1,154 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include <pthread.h>
+
+#include "ethernet_api.h"
+#include "mbed_interface.h"
+#include "host_model.h"
+
+/* In-process ethernet: the frames sent are queued for the test to
+ * capture, or looped back, and the test injects the frames received.
+ */
+#define ETH_FRAME_MAX   1536
+#define ETH_QUEUE_SIZE  16
+
+typedef struct {
+    int size;
+    char data[ETH_FRAME_MAX];
+} frame_t;
+
+typedef struct {
+    frame_t frames[ETH_QUEUE_SIZE];
+    int head;
+    int count;
+} frame_queue_t;
+
+static pthread_mutex_t eth_lock = PTHREAD_MUTEX_INITIALIZER;
+static frame_queue_t rx_queue, tx_queue;
+static int loopback;
+
+static frame_t tx_frame;        // being written
+static frame_t rx_frame;        // being read
+static int rx_offset;
+
+// Called with eth_lock held
+static int queue_push(frame_queue_t *queue, const char *data, int size) {
+    if ((queue->count == ETH_QUEUE_SIZE) || (size > ETH_FRAME_MAX)) {
+        return -1;
+    }
+    frame_t *frame = &queue->frames[(queue->head + queue->count) % ETH_QUEUE_SIZE];
+    memcpy(frame->data, data, size);
+    frame->size = size;
+    queue->count++;
+    return 0;
+}
+
+// Called with eth_lock held
+static int queue_pop(frame_queue_t *queue, char *data, int size) {
+    if (queue->count == 0) {
+        return 0;
+    }
+    frame_t *frame = &queue->frames[queue->head];
+    if (size > frame->size) {
+        size = frame->size;
+    }
+    memcpy(data, frame->data, size);
+    queue->head = (queue->head + 1) % ETH_QUEUE_SIZE;
+    queue->count--;
+    return size;
+}
+
+int ethernet_init() {
+    pthread_mutex_lock(&eth_lock);
+    rx_queue.count = tx_queue.count = 0;
+    tx_frame.size = rx_frame.size = rx_offset = 0;
+    pthread_mutex_unlock(&eth_lock);
+    return 0;
+}
+
+void ethernet_free() {
+}
+
+int ethernet_write(const char *data, int size) {
+    if (tx_frame.size + size > ETH_FRAME_MAX) {
+        return -1;
+    }
+    memcpy(&tx_frame.data[tx_frame.size], data, size);
+    tx_frame.size += size;
+    return size;
+}
+
+int ethernet_send() {
+    int size = tx_frame.size;
+    tx_frame.size = 0;
+
+    pthread_mutex_lock(&eth_lock);
+    int res = queue_push(loopback ? &rx_queue : &tx_queue, tx_frame.data, size);
+    pthread_mutex_unlock(&eth_lock);
+    return (res < 0) ? 0 : size;
+}
+
+int ethernet_receive() {
+    pthread_mutex_lock(&eth_lock);
+    rx_frame.size = queue_pop(&rx_queue, rx_frame.data, ETH_FRAME_MAX);
+    rx_offset = 0;
+    pthread_mutex_unlock(&eth_lock);
+    return rx_frame.size;
+}
+
+int ethernet_read(char *data, int size) {
+    int left = rx_frame.size - rx_offset;
+    if (size > left) {
+        size = left;
+    }
+    if (data != NULL) {
+        memcpy(data, &rx_frame.data[rx_offset], size);
+    }
+    rx_offset += size;
+    return size;
+}
+
+void ethernet_address(char *mac) {
+    mbed_mac_address(mac);
+}
+
+int ethernet_link(void) {
+    return 1;
+}
+
+void ethernet_set_link(int speed, int duplex) {
+}
+
+int host_ethernet_inject(const char *data, int size) {
+    pthread_mutex_lock(&eth_lock);
+    int res = queue_push(&rx_queue, data, size);
+    pthread_mutex_unlock(&eth_lock);
+    return res;
+}
+
+int host_ethernet_capture(char *data, int size) {
+    pthread_mutex_lock(&eth_lock);
+    int res = queue_pop(&tx_queue, data, size);
+    pthread_mutex_unlock(&eth_lock);
+    return res;
+}
+
+void host_ethernet_loopback(int enable) {
+    pthread_mutex_lock(&eth_lock);
+    loopback = enable;
+    pthread_mutex_unlock(&eth_lock);
+}
@@ -0,0 +1,66 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mbed_assert.h"
+#include "gpio_api.h"
+#include "pinmap.h"
+
+/* Levels of the pins, set by the outputs of the HAL and by the tests */
+static volatile uint32_t levels[HOST_GPIO_PINS / 32];
+
+extern void gpio_irq_edge(PinName pin, int value);
+
+void host_gpio_write(PinName pin, int value) {
+    MBED_ASSERT((uint32_t)pin < HOST_GPIO_PINS);
+    uint32_t mask = 1UL << ((int)pin & 0x1F);
+    uint32_t previous;
+
+    if (value) {
+        previous = __sync_fetch_and_or(&levels[(int)pin >> 5], mask);
+    } else {
+        previous = __sync_fetch_and_and(&levels[(int)pin >> 5], ~mask);
+    }
+    if (((previous & mask) != 0) != (value != 0)) {
+        gpio_irq_edge(pin, value);
+    }
+}
+
+int host_gpio_read(PinName pin) {
+    MBED_ASSERT((uint32_t)pin < HOST_GPIO_PINS);
+    return (levels[(int)pin >> 5] >> ((int)pin & 0x1F)) & 1;
+}
+
+uint32_t gpio_set(PinName pin) {
+    MBED_ASSERT(pin != (PinName)NC);
+    pin_function(pin, 0);
+    return (1 << ((int)pin & 0x1F));
+}
+
+void gpio_init(gpio_t *obj, PinName pin) {
+    obj->pin = pin;
+    if (pin == (PinName)NC)
+        return;
+
+    gpio_set(pin);
+}
+
+void gpio_mode(gpio_t *obj, PinMode mode) {
+    pin_mode(obj->pin, mode);
+}
+
+void gpio_dir(gpio_t *obj, PinDirection direction) {
+    MBED_ASSERT(obj->pin != (PinName)NC);
+    // the level stays where it was, whoever writes the pin drives it
+}
@@ -0,0 +1,101 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+
+#include "gpio_irq_api.h"
+#include "error.h"
+#include "cmsis.h"
+
+#define CHANNEL_NUM     HOST_GPIO_PINS
+#define WORDS           (CHANNEL_NUM / 32)
+
+static uint32_t channel_ids[CHANNEL_NUM] = {0};
+static gpio_irq_handler irq_handler;
+
+/* Edges enabled and edges seen since the last interrupt, one bit per pin */
+static volatile uint32_t rise_enabled[WORDS], fall_enabled[WORDS];
+static volatile uint32_t rise_pending[WORDS], fall_pending[WORDS];
+
+// Called by the GPIO model, from any thread
+void gpio_irq_edge(PinName pin, int value) {
+    int word = (int)pin >> 5;
+    uint32_t mask = 1UL << ((int)pin & 0x1F);
+
+    if (value && (rise_enabled[word] & mask)) {
+        __sync_fetch_and_or(&rise_pending[word], mask);
+        NVIC_SetPendingIRQ(EINT_IRQn);
+    } else if (!value && (fall_enabled[word] & mask)) {
+        __sync_fetch_and_or(&fall_pending[word], mask);
+        NVIC_SetPendingIRQ(EINT_IRQn);
+    }
+}
+
+static void handle_interrupt_in(void) {
+    for (int word = 0; word < WORDS; word++) {
+        uint32_t rise = __sync_fetch_and_and(&rise_pending[word], 0);
+        uint32_t fall = __sync_fetch_and_and(&fall_pending[word], 0);
+
+        while (rise) {
+            int ch = word * 32 + __builtin_ctz(rise);
+            if (channel_ids[ch] != 0)
+                irq_handler(channel_ids[ch], IRQ_RISE);
+            rise &= rise - 1;
+        }
+        while (fall) {
+            int ch = word * 32 + __builtin_ctz(fall);
+            if (channel_ids[ch] != 0)
+                irq_handler(channel_ids[ch], IRQ_FALL);
+            fall &= fall - 1;
+        }
+    }
+}
+
+int gpio_irq_init(gpio_irq_t *obj, PinName pin, gpio_irq_handler handler, uint32_t id) {
+    if (pin == NC) return -1;
+
+    irq_handler = handler;
+    obj->ch = (uint32_t)pin;
+    channel_ids[obj->ch] = id;
+
+    NVIC_SetVector(EINT_IRQn, (uint32_t)handle_interrupt_in);
+    NVIC_EnableIRQ(EINT_IRQn);
+    return 0;
+}
+
+void gpio_irq_free(gpio_irq_t *obj) {
+    gpio_irq_disable(obj);
+    channel_ids[obj->ch] = 0;
+}
+
+void gpio_irq_set(gpio_irq_t *obj, gpio_irq_event event, uint32_t enable) {
+    int word = obj->ch >> 5;
+    uint32_t mask = 1UL << (obj->ch & 0x1F);
+    volatile uint32_t *edges = (event == IRQ_RISE) ? rise_enabled : fall_enabled;
+
+    if (enable) {
+        __sync_fetch_and_or(&edges[word], mask);
+    } else {
+        __sync_fetch_and_and(&edges[word], ~mask);
+    }
+}
+
+void gpio_irq_enable(gpio_irq_t *obj) {
+    NVIC_EnableIRQ(EINT_IRQn);
+}
+
+void gpio_irq_disable(gpio_irq_t *obj) {
+    NVIC_DisableIRQ(EINT_IRQn);
+}
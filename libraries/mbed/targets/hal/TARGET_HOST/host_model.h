@@ -0,0 +1,59 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_HOST_MODEL_H
+#define MBED_HOST_MODEL_H
+
+#include "PinNames.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The peripheral models of the host target. Tests drive the inputs and
+ * look at the outputs through these functions, from any thread.
+ */
+
+/** Set the level of a pin, the edge interrupts of the pin fire as on a
+ *  real input. The HAL writes its outputs through the same function.
+ */
+void host_gpio_write(PinName pin, int value);
+
+/** Read the level of a pin */
+int host_gpio_read(PinName pin);
+
+/** Queue a frame for ethernet_receive()
+ *
+ *  @returns 0 on success, -1 if the receive queue is full
+ */
+int host_ethernet_inject(const char *data, int size);
+
+/** Take the oldest frame passed to ethernet_send()
+ *
+ *  @returns The size of the frame, 0 if none was sent
+ */
+int host_ethernet_capture(char *data, int size);
+
+/** Feed the frames sent back to the receive queue instead of keeping them */
+void host_ethernet_loopback(int enable);
+
+/** Path of the pseudo terminal behind a UART, NULL for the stdio one */
+const char *host_serial_name(int uart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
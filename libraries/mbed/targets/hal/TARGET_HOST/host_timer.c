@@ -0,0 +1,98 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "host_timer.h"
+
+static uint32_t read_counter(host_timer_t *timer, struct timespec *now) {
+    clock_gettime(CLOCK_MONOTONIC, now);
+    int64_t ns = (int64_t)(now->tv_sec - timer->start.tv_sec) * 1000000000 +
+                 (now->tv_nsec - timer->start.tv_nsec);
+    uint64_t ticks = (uint64_t)(ns / 1000000000) * timer->frequency +
+                     (uint64_t)(ns % 1000000000) * timer->frequency / 1000000000;
+    return (uint32_t)(ticks * 1000000 / timer->frequency);
+}
+
+static void *timer_thread(void *arg) {
+    host_timer_t *timer = (host_timer_t *)arg;
+
+    pthread_mutex_lock(&timer->lock);
+    while (1) {
+        if (!timer->match_enabled) {
+            pthread_cond_wait(&timer->changed, &timer->lock);
+            continue;
+        }
+
+        struct timespec now;
+        int32_t delta = (int32_t)(timer->match - read_counter(timer, &now));
+        if (delta <= 0) {
+            timer->match_enabled = 0;
+            NVIC_SetPendingIRQ(timer->irq);
+            continue;
+        }
+
+        // the counter only moves on a tick of the clock, wake up at the next one
+        uint32_t tick_ns = 1000000000 / timer->frequency;
+        uint64_t wait_ns = (uint64_t)delta * 1000 + tick_ns;
+        struct timespec deadline = now;
+        deadline.tv_sec += wait_ns / 1000000000;
+        deadline.tv_nsec += wait_ns % 1000000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_nsec -= 1000000000;
+            deadline.tv_sec++;
+        }
+        pthread_cond_timedwait(&timer->changed, &timer->lock, &deadline);
+    }
+    return NULL;
+}
+
+void host_timer_init(host_timer_t *timer, IRQn_Type irq, uint32_t frequency, void (*handler)(void)) {
+    timer->irq = irq;
+    timer->frequency = frequency;
+    timer->match_enabled = 0;
+    clock_gettime(CLOCK_MONOTONIC, &timer->start);
+
+    pthread_mutex_init(&timer->lock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&timer->changed, &attr);
+    pthread_condattr_destroy(&attr);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, timer_thread, timer);
+    pthread_detach(thread);
+
+    NVIC_SetVector(irq, (uint32_t)handler);
+    NVIC_EnableIRQ(irq);
+}
+
+uint32_t host_timer_read(host_timer_t *timer) {
+    struct timespec now;
+    return read_counter(timer, &now);
+}
+
+void host_timer_set_match(host_timer_t *timer, uint32_t match) {
+    pthread_mutex_lock(&timer->lock);
+    timer->match = match;
+    timer->match_enabled = 1;
+    pthread_cond_signal(&timer->changed);
+    pthread_mutex_unlock(&timer->lock);
+}
+
+void host_timer_disable_match(host_timer_t *timer) {
+    pthread_mutex_lock(&timer->lock);
+    timer->match_enabled = 0;
+    pthread_mutex_unlock(&timer->lock);
+}
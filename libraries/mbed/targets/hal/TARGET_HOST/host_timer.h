@@ -0,0 +1,51 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MBED_HOST_TIMER_H
+#define MBED_HOST_TIMER_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include "cmsis.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A timer counting CLOCK_MONOTONIC in micro-seconds, at the resolution of
+ * a clock of the given frequency. A thread sleeps until the match time and
+ * raises the interrupt, once, like the compare of a hardware timer.
+ */
+typedef struct {
+    IRQn_Type irq;
+    uint32_t frequency;
+    struct timespec start;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint32_t match;
+    int match_enabled;
+} host_timer_t;
+
+void host_timer_init(host_timer_t *timer, IRQn_Type irq, uint32_t frequency, void (*handler)(void));
+uint32_t host_timer_read(host_timer_t *timer);
+void host_timer_set_match(host_timer_t *timer, uint32_t match);
+void host_timer_disable_match(host_timer_t *timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "lp_ticker_api.h"
+#include "host_timer.h"
+
+/* Simulates a 32768 Hz RTC: the counter is in micro-seconds but moves in
+ * steps of about 30.5 us, and keeps running in deepsleep().
+ */
+#define LP_TICKER_TIMER_IRQn LPTIMER0_IRQn
+#define LP_TICKER_FREQUENCY  32768
+
+static int lp_ticker_inited = 0;
+
+static host_timer_t timer;
+
+void lp_ticker_init(void) {
+    if (lp_ticker_inited) return;
+    lp_ticker_inited = 1;
+
+    host_timer_init(&timer, LP_TICKER_TIMER_IRQn, LP_TICKER_FREQUENCY, lp_ticker_irq_handler);
+}
+
+uint32_t lp_ticker_read() {
+    if (!lp_ticker_inited)
+        lp_ticker_init();
+
+    return host_timer_read(&timer);
+}
+
+void lp_ticker_set_interrupt(unsigned int timestamp) {
+    host_timer_set_match(&timer, timestamp);
+}
+
+void lp_ticker_disable_interrupt(void) {
+    host_timer_disable_match(&timer);
+}
+
+void lp_ticker_clear_interrupt(void) {
+    NVIC_ClearPendingIRQ(LP_TICKER_TIMER_IRQn);
+}
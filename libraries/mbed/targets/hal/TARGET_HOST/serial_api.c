@@ -0,0 +1,278 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "mbed_assert.h"
+#include "serial_api.h"
+#include "cmsis.h"
+#include "pinmap.h"
+
+/******************************************************************************
+ * INITIALIZATION
+ ******************************************************************************/
+#define UART_NUM    3
+
+static const PinMap PinMap_UART_TX[] = {
+    {USBTX, UART_0, 0},
+    {p9   , UART_1, 0},
+    {p13  , UART_2, 0},
+    {NC   , NC    , 0}
+};
+
+static const PinMap PinMap_UART_RX[] = {
+    {USBRX, UART_0, 0},
+    {p10  , UART_1, 0},
+    {p14  , UART_2, 0},
+    {NC   , NC    , 0}
+};
+
+static const IRQn_Type uart_irqs[UART_NUM] = {UART0_IRQn, UART1_IRQn, UART2_IRQn};
+
+static uart_irq_handler irq_handler;
+
+int stdio_uart_inited = 0;
+serial_t stdio_uart;
+
+/* UART_0 uses the descriptors of the process, the other UARTs are the
+ * master side of a pseudo terminal. A reader thread raises the receive
+ * interrupt while data is waiting and the receive interrupt is enabled,
+ * the transmitter is always ready.
+ */
+struct serial_global_data_s {
+    uint32_t serial_irq_id;
+    int opened;
+    int fd_in, fd_out;
+    char name[32];
+    int rx_irq, tx_irq;
+    int rx_handled;
+    int reader_started;
+};
+
+static struct serial_global_data_s uart_data[UART_NUM];
+static pthread_mutex_t uart_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t uart_changed = PTHREAD_COND_INITIALIZER;
+
+static int readable(int fd) {
+    struct pollfd fds = {fd, POLLIN, 0};
+    return (poll(&fds, 1, 0) > 0) && (fds.revents & POLLIN);
+}
+
+static void *reader_thread(void *arg) {
+    int index = (int)(intptr_t)arg;
+    struct serial_global_data_s *data = &uart_data[index];
+    struct pollfd fds = {data->fd_in, POLLIN, 0};
+
+    while (1) {
+        pthread_mutex_lock(&uart_lock);
+        while (!data->rx_irq) {
+            pthread_cond_wait(&uart_changed, &uart_lock);
+        }
+        pthread_mutex_unlock(&uart_lock);
+
+        if ((poll(&fds, 1, 100) <= 0) || !(fds.revents & POLLIN)) {
+            continue;
+        }
+
+        // level triggered: raise the interrupt again once it was handled
+        pthread_mutex_lock(&uart_lock);
+        data->rx_handled = 0;
+        NVIC_SetPendingIRQ(uart_irqs[index]);
+        while (!data->rx_handled && data->rx_irq) {
+            pthread_cond_wait(&uart_changed, &uart_lock);
+        }
+        pthread_mutex_unlock(&uart_lock);
+    }
+    return NULL;
+}
+
+static int open_terminal(struct serial_global_data_s *data) {
+    int fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((fd < 0) || (grantpt(fd) < 0) || (unlockpt(fd) < 0)) {
+        return -1;
+    }
+    strncpy(data->name, ptsname(fd), sizeof(data->name) - 1);
+    fprintf(stderr, "serial: %s\n", data->name);
+    return fd;
+}
+
+void serial_init(serial_t *obj, PinName tx, PinName rx) {
+    int is_stdio_uart = 0;
+
+    // determine the UART to use
+    UARTName uart_tx = (UARTName)pinmap_peripheral(tx, PinMap_UART_TX);
+    UARTName uart_rx = (UARTName)pinmap_peripheral(rx, PinMap_UART_RX);
+    UARTName uart = (UARTName)pinmap_merge(uart_tx, uart_rx);
+    MBED_ASSERT((int)uart != NC);
+
+    obj->index = (int)uart;
+    struct serial_global_data_s *data = &uart_data[obj->index];
+
+    pthread_mutex_lock(&uart_lock);
+    if (!data->opened) {
+        data->opened = 1;
+        if (uart == UART_0) {
+            data->fd_in = STDIN_FILENO;
+            data->fd_out = STDOUT_FILENO;
+        } else {
+            data->fd_in = data->fd_out = open_terminal(data);
+            MBED_ASSERT(data->fd_in >= 0);
+        }
+    }
+    pthread_mutex_unlock(&uart_lock);
+
+    is_stdio_uart = (uart == STDIO_UART) ? (1) : (0);
+
+    if (is_stdio_uart) {
+        stdio_uart_inited = 1;
+        memcpy(&stdio_uart, obj, sizeof(serial_t));
+    }
+}
+
+void serial_free(serial_t *obj) {
+    serial_irq_set(obj, RxIrq, 0);
+    serial_irq_set(obj, TxIrq, 0);
+    uart_data[obj->index].serial_irq_id = 0;
+}
+
+// The line settings do not apply to a pipe or a pseudo terminal
+void serial_baud(serial_t *obj, int baudrate) {
+}
+
+void serial_format(serial_t *obj, int data_bits, SerialParity parity, int stop_bits) {
+}
+
+/******************************************************************************
+ * INTERRUPTS HANDLING
+ ******************************************************************************/
+static void uart_irq(int index) {
+    struct serial_global_data_s *data = &uart_data[index];
+
+    if (data->serial_irq_id != 0) {
+        if (data->tx_irq)
+            irq_handler(data->serial_irq_id, TxIrq);
+        if (data->rx_irq && readable(data->fd_in))
+            irq_handler(data->serial_irq_id, RxIrq);
+    }
+
+    pthread_mutex_lock(&uart_lock);
+    data->rx_handled = 1;
+    pthread_cond_broadcast(&uart_changed);
+    // the transmitter stays empty, so its interrupt keeps firing
+    if (data->tx_irq)
+        NVIC_SetPendingIRQ(uart_irqs[index]);
+    pthread_mutex_unlock(&uart_lock);
+}
+
+static void uart0_irq(void) {uart_irq(0);}
+static void uart1_irq(void) {uart_irq(1);}
+static void uart2_irq(void) {uart_irq(2);}
+
+static void (*const uart_vectors[UART_NUM])(void) = {uart0_irq, uart1_irq, uart2_irq};
+
+void serial_irq_handler(serial_t *obj, uart_irq_handler handler, uint32_t id) {
+    irq_handler = handler;
+    uart_data[obj->index].serial_irq_id = id;
+}
+
+void serial_irq_set(serial_t *obj, SerialIrq irq, uint32_t enable) {
+    struct serial_global_data_s *data = &uart_data[obj->index];
+    IRQn_Type irq_n = uart_irqs[obj->index];
+
+    pthread_mutex_lock(&uart_lock);
+    if (irq == RxIrq) {
+        data->rx_irq = enable;
+        if (enable && !data->reader_started) {
+            pthread_t thread;
+            data->reader_started = 1;
+            pthread_create(&thread, NULL, reader_thread, (void*)(intptr_t)obj->index);
+            pthread_detach(thread);
+        }
+    } else {
+        data->tx_irq = enable;
+    }
+    pthread_cond_broadcast(&uart_changed);
+    pthread_mutex_unlock(&uart_lock);
+
+    if (enable) {
+        NVIC_SetVector(irq_n, (uint32_t)uart_vectors[obj->index]);
+        NVIC_EnableIRQ(irq_n);
+        if (irq == TxIrq)
+            NVIC_SetPendingIRQ(irq_n);
+    }
+}
+
+/******************************************************************************
+ * READ/WRITE
+ ******************************************************************************/
+int serial_getc(serial_t *obj) {
+    unsigned char c;
+    while (read(uart_data[obj->index].fd_in, &c, 1) != 1);
+    return c;
+}
+
+void serial_putc(serial_t *obj, int c) {
+    unsigned char data = c;
+    while (write(uart_data[obj->index].fd_out, &data, 1) != 1);
+}
+
+int serial_readable(serial_t *obj) {
+    return readable(uart_data[obj->index].fd_in);
+}
+
+int serial_writable(serial_t *obj) {
+    return 1;
+}
+
+int serial_write_block(serial_t *obj, const char *data, int length) {
+    int n = write(uart_data[obj->index].fd_out, data, length);
+    return (n < 0) ? 0 : n;
+}
+
+int serial_read_block(serial_t *obj, char *data, int length, int *overrun) {
+    int n = 0;
+    *overrun = 0;
+    if (serial_readable(obj)) {
+        n = read(uart_data[obj->index].fd_in, data, length);
+    }
+    return (n < 0) ? 0 : n;
+}
+
+void serial_clear(serial_t *obj) {
+}
+
+void serial_pinout_tx(PinName tx) {
+    pinmap_pinout(tx, PinMap_UART_TX);
+}
+
+void serial_break_set(serial_t *obj) {
+}
+
+void serial_break_clear(serial_t *obj) {
+}
+
+void serial_set_flow_control(serial_t *obj, FlowControl type, PinName rxflow, PinName txflow) {
+}
+
+const char *host_serial_name(int uart) {
+    return ((uart > 0) && (uart < UART_NUM) && uart_data[uart].opened) ? uart_data[uart].name : NULL;
+}
@@ -0,0 +1,33 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sleep_api.h"
+#include "cmsis.h"
+
+void sleep(void) {
+    // returns once an interrupt was handled
+    __WFI();
+}
+
+// The us_ticker clock stops in deep sleep, only the lp_ticker and the
+// other interrupts wake the core up
+void deepsleep(void) {
+    uint32_t ticker_enabled = NVIC_GetEnableIRQ(TIMER0_IRQn);
+    NVIC_DisableIRQ(TIMER0_IRQn);
+    __WFI();
+    if (ticker_enabled) {
+        NVIC_EnableIRQ(TIMER0_IRQn);
+    }
+}
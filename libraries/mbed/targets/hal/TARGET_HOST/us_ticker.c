@@ -0,0 +1,50 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2013 ARM Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "us_ticker_api.h"
+#include "host_timer.h"
+
+#define US_TICKER_TIMER_IRQn TIMER0_IRQn
+
+int us_ticker_inited = 0;
+
+static host_timer_t timer;
+
+void us_ticker_init(void) {
+    if (us_ticker_inited) return;
+    us_ticker_inited = 1;
+
+    host_timer_init(&timer, US_TICKER_TIMER_IRQn, 1000000, us_ticker_irq_handler);
+}
+
+uint32_t us_ticker_read() {
+    if (!us_ticker_inited)
+        us_ticker_init();
+
+    return host_timer_read(&timer);
+}
+
+void us_ticker_set_interrupt(unsigned int timestamp) {
+    host_timer_set_match(&timer, timestamp);
+}
+
+void us_ticker_disable_interrupt(void) {
+    host_timer_disable_match(&timer);
+}
+
+void us_ticker_clear_interrupt(void) {
+    NVIC_ClearPendingIRQ(US_TICKER_TIMER_IRQn);
+}
@@ -23,16 +23,20 @@
 #define DEVICE_INTERRUPTIN      1
 
 #define DEVICE_ANALOGIN         1
+#define DEVICE_ANALOGIN_STREAM  1
 #define DEVICE_ANALOGOUT        1
 
 #define DEVICE_SERIAL           1
 #define DEVICE_SERIAL_FC        1
+#define DEVICE_SERIAL_BLOCK     1
 
 #define DEVICE_I2C              1
 #define DEVICE_I2CSLAVE         1
+#define DEVICE_I2C_ASYNCH       1
 
 #define DEVICE_SPI              1
 #define DEVICE_SPISLAVE         1
+#define DEVICE_SPI_ASYNCH       1
 
 #define DEVICE_CAN              1
 
@@ -123,3 +123,120 @@ float analogin_read(analogin_t *obj) {
     uint32_t value = adc_read_u32(obj);
     return (float)value * (1.0f / (float)ADC_RANGE);
 }
+
+#if DEVICE_ANALOGIN_STREAM
+
+// TIMER1 paces the conversions: MAT1.0 toggles on every match of MR0 and
+// the ADC starts a conversion on each of its rising edges. The result is
+// collected from the ADC interrupt, which also selects the next channel.
+
+#define ADC_START_MAT1_0    (6 << 24)
+
+static struct {
+    uint8_t channels[8];
+    int count;
+    int channel;
+    void *buffer;
+    int length;
+    int pos;
+    AnalogInFormat format;
+    analogin_stream_handler handler;
+    uint32_t id;
+    uint32_t overruns;
+} stream;
+
+static void analogin_stream_irq(void) {
+    // reading ADGDR clears the DONE flag and the interrupt
+    uint32_t data = LPC_ADC->ADGDR;
+    uint32_t value = (data >> 4) & ADC_RANGE;
+
+    if (data & (1UL << 30))
+        stream.overruns++;
+
+    if (stream.count > 1) {
+        if (++stream.channel == stream.count)
+            stream.channel = 0;
+        LPC_ADC->ADCR = (LPC_ADC->ADCR & ~0xFF) | (1 << stream.channels[stream.channel]);
+    }
+
+    switch (stream.format) {
+        case AnalogInFormatU16:
+            ((uint16_t*)stream.buffer)[stream.pos] = (value << 4) | (value >> 8);
+            break;
+        case AnalogInFormatQ15:
+            ((int16_t*)stream.buffer)[stream.pos] = (value << 3) | (value >> 9);
+            break;
+        case AnalogInFormatF32:
+            ((float*)stream.buffer)[stream.pos] = (float)value * (1.0f / (float)ADC_RANGE);
+            break;
+    }
+
+    if (++stream.pos == stream.length / 2) {
+        stream.handler(stream.id, 0);
+    } else if (stream.pos == stream.length) {
+        stream.pos = 0;
+        stream.handler(stream.id, 1);
+    }
+}
+
+int analogin_stream_start(analogin_t *channels, int count, uint32_t rate, void *buffer, int length,
+                          AnalogInFormat format, analogin_stream_handler handler, uint32_t id) {
+    int i;
+    uint32_t conversions = rate * count;
+
+    if ((count < 1) || (count > 8) || (conversions == 0) || (length % (2 * count)))
+        return -1;
+
+    // TIMER1 clocked at CCLK, two matches per conversion
+    LPC_SC->PCONP |= 1 << 2;
+    LPC_SC->PCLKSEL0 &= ~(0x3 << 4);
+    LPC_SC->PCLKSEL0 |=  (0x1 << 4);
+    uint32_t period = SystemCoreClock / (2 * conversions);
+    if (period < 2)
+        return -1;
+
+    analogin_stream_stop();
+
+    for (i = 0; i < count; i++)
+        stream.channels[i] = (uint8_t)channels[i].adc;
+    stream.count = count;
+    stream.channel = 0;
+    stream.buffer = buffer;
+    stream.length = length;
+    stream.pos = 0;
+    stream.format = format;
+    stream.handler = handler;
+    stream.id = id;
+    stream.overruns = 0;
+
+    LPC_TIM1->TCR = 1 << 1;             // hold in reset
+    LPC_TIM1->PR  = 0;
+    LPC_TIM1->MR0 = period - 1;
+    LPC_TIM1->MCR = 1 << 1;             // reset on MR0
+    LPC_TIM1->EMR = 3 << 4;             // toggle MAT1.0 on MR0
+
+    (void)LPC_ADC->ADGDR;
+    LPC_ADC->ADCR = (LPC_ADC->ADCR & ~(0xFF | (7 << 24) | (1 << 27)))
+                  | (1 << stream.channels[0])
+                  | ADC_START_MAT1_0;
+    LPC_ADC->ADINTEN = 1 << 8;          // interrupt on the global DONE flag
+
+    NVIC_SetVector(ADC_IRQn, (uint32_t)&analogin_stream_irq);
+    NVIC_EnableIRQ(ADC_IRQn);
+
+    LPC_TIM1->TCR = 1;
+    return 0;
+}
+
+void analogin_stream_stop(void) {
+    LPC_TIM1->TCR = 0;
+    NVIC_DisableIRQ(ADC_IRQn);
+    LPC_ADC->ADCR &= ~(0xFF | (7 << 24));
+    (void)LPC_ADC->ADGDR;
+}
+
+uint32_t analogin_stream_overruns(void) {
+    return stream.overruns;
+}
+
+#endif
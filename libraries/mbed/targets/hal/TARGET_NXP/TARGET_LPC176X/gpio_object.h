@@ -45,6 +45,35 @@ static inline int gpio_read(gpio_t *obj) {
     return ((*obj->reg_in & obj->mask) ? 1 : 0);
 }
 
+/* Register level access for the FastIO templates. With a constant pin the
+ * port and bit are integral constant expressions, so the accesses below
+ * fold into single stores to constant addresses.
+ */
+#define GPIO_FAST_IO            1
+#define GPIO_FAST_PORT(pin)     ((uint32_t)(pin) & ~0x1FUL)
+#define GPIO_FAST_BIT(pin)      ((uint32_t)(pin) & 0x1FUL)
+
+static inline void gpio_fast_write(uint32_t port, uint32_t set, uint32_t clr) {
+    if (set)
+        ((LPC_GPIO_TypeDef*)port)->FIOSET = set;
+    if (clr)
+        ((LPC_GPIO_TypeDef*)port)->FIOCLR = clr;
+}
+
+static inline uint32_t gpio_fast_read(uint32_t port) {
+    return ((LPC_GPIO_TypeDef*)port)->FIOPIN;
+}
+
+static inline uint32_t gpio_fast_output(uint32_t port) {
+    return ((LPC_GPIO_TypeDef*)port)->FIOPIN;
+}
+
+static inline void gpio_fast_toggle(uint32_t port, uint32_t mask) {
+    uint32_t pins = ((LPC_GPIO_TypeDef*)port)->FIOPIN;
+    ((LPC_GPIO_TypeDef*)port)->FIOSET = ~pins & mask;
+    ((LPC_GPIO_TypeDef*)port)->FIOCLR = pins & mask;
+}
+
 #ifdef __cplusplus
 }
 #endif
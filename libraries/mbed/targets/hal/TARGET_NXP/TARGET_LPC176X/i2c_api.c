@@ -392,3 +392,166 @@ void i2c_slave_address(i2c_t *obj, int idx, uint32_t address, uint32_t mask) {
         *((uint32_t *) addr) = mask & 0xFE;
     }
 }
+
+#if DEVICE_I2C_ASYNCH
+
+typedef struct {
+    i2c_t obj;
+    int address;
+    const char *tx;
+    int tx_length;
+    int tx_pos;
+    char *rx;
+    int rx_length;
+    int rx_pos;
+    i2c_async_handler handler;
+    uint32_t id;
+} i2c_transfer_t;
+
+static i2c_transfer_t i2c_transfers[3];
+
+static inline int i2c_transfer_index(i2c_t *obj) {
+    switch ((int)obj->i2c) {
+        case I2C_0: return 0;
+        case I2C_1: return 1;
+        default:    return 2;
+    }
+}
+
+static const IRQn_Type i2c_irq_n[3] = {I2C0_IRQn, I2C1_IRQn, I2C2_IRQn};
+
+static void i2c_transfer_end(i2c_transfer_t *t, int event) {
+    i2c_async_handler handler = t->handler;
+
+    // send the stop condition, the hardware clears STO once it is on the bus
+    i2c_conset(&t->obj, 0, 1, 0, 0);
+    i2c_clear_SI(&t->obj);
+
+    NVIC_DisableIRQ(i2c_irq_n[i2c_transfer_index(&t->obj)]);
+    t->handler = 0;
+    handler(t->id, event);
+}
+
+// One step of the master state machine, run for every status change
+static void i2c_transfer_irq(i2c_transfer_t *t) {
+    i2c_t *obj = &t->obj;
+
+    if (t->handler == 0)
+        return;
+
+    switch (i2c_status(obj)) {
+        case 0x08:  // start sent
+            if ((t->tx_length > 0) || (t->rx_length == 0)) {
+                I2C_DAT(obj) = t->address & 0xFE;
+            } else {
+                I2C_DAT(obj) = t->address | 0x01;
+            }
+            i2c_conclr(obj, 1, 0, 1, 0);
+            break;
+
+        case 0x10:  // repeated start sent, the write part is done
+            I2C_DAT(obj) = t->address | 0x01;
+            i2c_conclr(obj, 1, 0, 1, 0);
+            break;
+
+        case 0x30:  // data sent, NACK received
+            if (t->tx_pos < t->tx_length) {
+                i2c_transfer_end(t, I2C_EVENT_TRANSFER_EARLY_NACK);
+                break;
+            }
+            // a NACK of the last byte ends the write like an ACK
+        case 0x18:  // SLA+W sent, ACK received
+        case 0x28:  // data sent, ACK received
+            if (t->tx_pos < t->tx_length) {
+                I2C_DAT(obj) = t->tx[t->tx_pos++];
+                i2c_clear_SI(obj);
+            } else if (t->rx_length > 0) {
+                i2c_conset(obj, 1, 0, 0, 0);
+                i2c_clear_SI(obj);
+            } else {
+                i2c_transfer_end(t, I2C_EVENT_COMPLETE);
+            }
+            break;
+
+        case 0x20:  // SLA+W sent, NACK received
+        case 0x48:  // SLA+R sent, NACK received
+            i2c_transfer_end(t, I2C_EVENT_ERROR_NO_SLAVE);
+            break;
+
+        case 0x40:  // SLA+R sent, ACK received
+            if (t->rx_length > 1) {
+                i2c_conset(obj, 0, 0, 0, 1);
+            } else {
+                i2c_conclr(obj, 0, 0, 0, 1);
+            }
+            i2c_clear_SI(obj);
+            break;
+
+        case 0x50:  // data received, ACK sent
+            t->rx[t->rx_pos++] = I2C_DAT(obj) & 0xFF;
+            if (t->rx_pos < t->rx_length - 1) {
+                i2c_conset(obj, 0, 0, 0, 1);
+            } else {
+                i2c_conclr(obj, 0, 0, 0, 1);   // NACK the last byte
+            }
+            i2c_clear_SI(obj);
+            break;
+
+        case 0x58:  // data received, NACK sent
+            t->rx[t->rx_pos++] = I2C_DAT(obj) & 0xFF;
+            i2c_transfer_end(t, I2C_EVENT_COMPLETE);
+            break;
+
+        default:    // arbitration lost or bus error
+            i2c_transfer_end(t, I2C_EVENT_ERROR);
+            break;
+    }
+}
+
+static void i2c0_irq(void) {i2c_transfer_irq(&i2c_transfers[0]);}
+static void i2c1_irq(void) {i2c_transfer_irq(&i2c_transfers[1]);}
+static void i2c2_irq(void) {i2c_transfer_irq(&i2c_transfers[2]);}
+
+void i2c_transfer_asynch(i2c_t *obj, int address, const char *tx, int tx_length,
+                         char *rx, int rx_length, i2c_async_handler handler, uint32_t id) {
+    int index = i2c_transfer_index(obj);
+    i2c_transfer_t *t = &i2c_transfers[index];
+    uint32_t vector = 0;
+
+    switch (index) {
+        case 0: vector = (uint32_t)&i2c0_irq; break;
+        case 1: vector = (uint32_t)&i2c1_irq; break;
+        case 2: vector = (uint32_t)&i2c2_irq; break;
+    }
+
+    t->obj = *obj;
+    t->address = address;
+    t->tx = tx;
+    t->tx_length = tx_length;
+    t->tx_pos = 0;
+    t->rx = rx;
+    t->rx_length = rx_length;
+    t->rx_pos = 0;
+    t->id = id;
+    t->handler = handler;
+
+    NVIC_SetVector(i2c_irq_n[index], vector);
+    NVIC_EnableIRQ(i2c_irq_n[index]);
+
+    // the start condition is sent as soon as the bus is free
+    i2c_conclr(obj, 1, 1, 1, 1);
+    i2c_conset(obj, 1, 0, 0, 1);
+}
+
+int i2c_active(i2c_t *obj) {
+    return i2c_transfers[i2c_transfer_index(obj)].handler != 0;
+}
+
+void i2c_abort_asynch(i2c_t *obj) {
+    int index = i2c_transfer_index(obj);
+    NVIC_DisableIRQ(i2c_irq_n[index]);
+    i2c_transfers[index].handler = 0;
+    i2c_stop(obj);
+}
+
+#endif
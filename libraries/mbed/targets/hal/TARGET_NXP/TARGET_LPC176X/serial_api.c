@@ -373,6 +373,42 @@ int serial_writable(serial_t *obj) {
     return isWritable;
 }
 
+int serial_write_block(serial_t *obj, const char *data, int length) {
+    int written = 0;
+    if (NC != uart_data[obj->index].sw_cts.pin) {
+        while ((written < length) && serial_writable(obj)) {
+            obj->uart->THR = data[written++];
+        }
+        return written;
+    }
+    if (obj->uart->LSR & 0x20)
+        uart_data[obj->index].count = 0;
+    while ((written < length) && (uart_data[obj->index].count < 16)) {
+        obj->uart->THR = data[written++];
+        uart_data[obj->index].count++;
+    }
+    return written;
+}
+
+int serial_read_block(serial_t *obj, char *data, int length, int *overrun) {
+    int count = 0;
+    *overrun = 0;
+    while (1) {
+        // reading LSR clears the overrun error bit
+        uint32_t lsr = obj->uart->LSR;
+        if (lsr & 0x02)
+            *overrun = 1;
+        if (!(lsr & 0x01) || (count >= length))
+            break;
+        data[count++] = obj->uart->RBR;
+    }
+    if ((count > 0) && (NC != uart_data[obj->index].sw_rts.pin)) {
+        gpio_write(&uart_data[obj->index].sw_rts, 0);
+        obj->uart->IER |= 1 << RxIrq;
+    }
+    return count;
+}
+
 void serial_clear(serial_t *obj) {
     obj->uart->FCR = 1 << 0  // FIFO Enable - 0 = Disables, 1 = Enabled
                    | 1 << 1  // rx FIFO reset
@@ -217,3 +217,126 @@ void spi_slave_write(spi_t *obj, int value) {
 int spi_busy(spi_t *obj) {
     return ssp_busy(obj);
 }
+
+#if DEVICE_SPI_ASYNCH
+
+// Words allowed in flight, the depth of the SSP receive FIFO
+#define SSP_FIFO_DEPTH  8
+
+typedef struct {
+    LPC_SSP_TypeDef *spi;
+    const uint8_t *tx;
+    uint8_t *rx;
+    int width;
+    int tx_left;
+    int rx_left;
+    spi_async_handler handler;
+    uint32_t id;
+} spi_transfer_t;
+
+static spi_transfer_t spi_transfers[2];
+
+static inline int spi_transfer_index(spi_t *obj) {
+    return ((int)obj->spi == SPI_0) ? 0 : 1;
+}
+
+static void spi_transfer_fill(spi_transfer_t *t) {
+    // never queue more words than the receive FIFO can hold
+    while ((t->tx_left > 0) && (t->rx_left - t->tx_left < SSP_FIFO_DEPTH) && (t->spi->SR & (1 << 1))) {
+        int value = SPI_FILL_WORD;
+        if (t->tx) {
+            value = (t->width == 2) ? *(const uint16_t*)t->tx : *t->tx;
+            t->tx += t->width;
+        }
+        t->spi->DR = value;
+        t->tx_left--;
+    }
+}
+
+static void spi_transfer_end(spi_transfer_t *t, int event) {
+    spi_async_handler handler = t->handler;
+    t->spi->IMSC = 0;
+    t->handler = 0;
+    handler(t->id, event);
+}
+
+static void spi_transfer_irq(spi_transfer_t *t) {
+    if (t->handler == 0)
+        return;
+    if (t->spi->RIS & (1 << 0)) {
+        t->spi->ICR = (1 << 0);
+        spi_transfer_end(t, SPI_EVENT_RX_OVERFLOW);
+        return;
+    }
+    while ((t->rx_left > 0) && (t->spi->SR & (1 << 2))) {
+        int value = t->spi->DR;
+        if (t->rx) {
+            if (t->width == 2) {
+                *(uint16_t*)t->rx = value;
+            } else {
+                *t->rx = value;
+            }
+            t->rx += t->width;
+        }
+        t->rx_left--;
+    }
+    t->spi->ICR = (1 << 1);
+    if (t->rx_left == 0) {
+        spi_transfer_end(t, SPI_EVENT_COMPLETE);
+    } else {
+        spi_transfer_fill(t);
+    }
+}
+
+static void ssp0_irq(void) {spi_transfer_irq(&spi_transfers[0]);}
+static void ssp1_irq(void) {spi_transfer_irq(&spi_transfers[1]);}
+
+void spi_master_transfer(spi_t *obj, const void *tx, void *rx, int length, int bits,
+                         spi_async_handler handler, uint32_t id) {
+    int index = spi_transfer_index(obj);
+    spi_transfer_t *t = &spi_transfers[index];
+    IRQn_Type irq_n = index ? SSP1_IRQn : SSP0_IRQn;
+
+    if (length <= 0) {
+        handler(id, SPI_EVENT_COMPLETE);
+        return;
+    }
+
+    // drop anything left over from a slave or an aborted transfer
+    while (ssp_readable(obj)) {
+        (void)obj->spi->DR;
+    }
+    obj->spi->ICR = (1 << 1) | (1 << 0);
+
+    t->spi = obj->spi;
+    t->tx = (const uint8_t*)tx;
+    t->rx = (uint8_t*)rx;
+    t->width = (bits > 8) ? 2 : 1;
+    t->tx_left = length;
+    t->rx_left = length;
+    t->id = id;
+    t->handler = handler;
+
+    NVIC_SetVector(irq_n, (uint32_t)(index ? &ssp1_irq : &ssp0_irq));
+    NVIC_EnableIRQ(irq_n);
+
+    spi_transfer_fill(t);
+    // RXIM on a half full FIFO, RTIM to drain the last few words
+    obj->spi->IMSC = (1 << 2) | (1 << 1) | (1 << 0);
+}
+
+int spi_active(spi_t *obj) {
+    return spi_transfers[spi_transfer_index(obj)].handler != 0;
+}
+
+void spi_abort_asynch(spi_t *obj) {
+    spi_transfer_t *t = &spi_transfers[spi_transfer_index(obj)];
+    obj->spi->IMSC = 0;
+    t->handler = 0;
+    while (ssp_busy(obj));
+    while (ssp_readable(obj)) {
+        (void)obj->spi->DR;
+    }
+}
+
+#endif
@@ -46,6 +46,32 @@ static inline int gpio_read(gpio_t *obj) {
     return ((*obj->reg_in & obj->mask) ? 1 : 0);
 }
 
+/* Register level access for the FastIO templates. With a constant pin the
+ * port and bit are integral constant expressions, so the accesses below
+ * fold into single stores to constant addresses. BSRR sets and clears in
+ * one write.
+ */
+#define GPIO_FAST_IO            1
+#define GPIO_FAST_PORT(pin)     (GPIOA_BASE + (((uint32_t)(pin) >> 4) << 10))
+#define GPIO_FAST_BIT(pin)      ((uint32_t)(pin) & 0xFUL)
+
+static inline void gpio_fast_write(uint32_t port, uint32_t set, uint32_t clr) {
+    *(__IO uint32_t*)&((GPIO_TypeDef*)port)->BSRRL = set | (clr << 16);
+}
+
+static inline uint32_t gpio_fast_read(uint32_t port) {
+    return ((GPIO_TypeDef*)port)->IDR;
+}
+
+static inline uint32_t gpio_fast_output(uint32_t port) {
+    return ((GPIO_TypeDef*)port)->ODR;
+}
+
+static inline void gpio_fast_toggle(uint32_t port, uint32_t mask) {
+    uint32_t pins = ((GPIO_TypeDef*)port)->ODR;
+    gpio_fast_write(port, ~pins & mask, pins & mask);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -226,4 +226,131 @@ int spi_busy(spi_t *obj) {
     return ssp_busy(obj);
 }
 
+#if DEVICE_SPI_ASYNCH
+
+typedef struct {
+    SPI_TypeDef *spi;
+    const uint8_t *tx;
+    uint8_t *rx;
+    int width;
+    int left;
+    spi_async_handler handler;
+    uint32_t id;
+} spi_transfer_t;
+
+static spi_transfer_t spi_transfers[3];
+
+static inline int spi_transfer_index(spi_t *obj) {
+    switch ((int)obj->spi) {
+        case SPI_1: return 0;
+        case SPI_2: return 1;
+        default:    return 2;
+    }
+}
+
+// The SPI has a single data register, keep one word in flight and send
+// the next one from the RXNE interrupt of the previous one
+static void spi_transfer_send(spi_transfer_t *t) {
+    int value = SPI_FILL_WORD;
+    if (t->tx) {
+        value = (t->width == 2) ? *(const uint16_t*)t->tx : *t->tx;
+        t->tx += t->width;
+    }
+    t->spi->DR = value & ((t->width == 2) ? 0xFFFF : 0xFF);
+}
+
+static void spi_transfer_end(spi_transfer_t *t, int event) {
+    spi_async_handler handler = t->handler;
+    t->spi->CR2 &= ~(SPI_CR2_RXNEIE | SPI_CR2_ERRIE);
+    t->handler = 0;
+    handler(t->id, event);
+}
+
+static void spi_transfer_irq(spi_transfer_t *t) {
+    if (t->handler == 0)
+        return;
+    if (t->spi->SR & SPI_SR_OVR) {
+        // cleared by reading DR then SR
+        (void)t->spi->DR;
+        (void)t->spi->SR;
+        spi_transfer_end(t, SPI_EVENT_RX_OVERFLOW);
+        return;
+    }
+    if (!(t->spi->SR & SPI_SR_RXNE))
+        return;
+    int value = t->spi->DR;
+    if (t->rx) {
+        if (t->width == 2) {
+            *(uint16_t*)t->rx = value;
+        } else {
+            *t->rx = value;
+        }
+        t->rx += t->width;
+    }
+    if (--t->left == 0) {
+        spi_transfer_end(t, SPI_EVENT_COMPLETE);
+    } else {
+        spi_transfer_send(t);
+    }
+}
+
+static void spi1_irq(void) {spi_transfer_irq(&spi_transfers[0]);}
+static void spi2_irq(void) {spi_transfer_irq(&spi_transfers[1]);}
+static void spi3_irq(void) {spi_transfer_irq(&spi_transfers[2]);}
+
+void spi_master_transfer(spi_t *obj, const void *tx, void *rx, int length, int bits,
+                         spi_async_handler handler, uint32_t id) {
+    int index = spi_transfer_index(obj);
+    spi_transfer_t *t = &spi_transfers[index];
+    IRQn_Type irq_n = (IRQn_Type)0;
+    uint32_t vector = 0;
+
+    switch (index) {
+        case 0: irq_n = SPI1_IRQn; vector = (uint32_t)&spi1_irq; break;
+        case 1: irq_n = SPI2_IRQn; vector = (uint32_t)&spi2_irq; break;
+        case 2: irq_n = SPI3_IRQn; vector = (uint32_t)&spi3_irq; break;
+    }
+
+    if (length <= 0) {
+        handler(id, SPI_EVENT_COMPLETE);
+        return;
+    }
+
+    // drop anything left over from a slave or an aborted transfer
+    while (ssp_readable(obj)) {
+        (void)obj->spi->DR;
+    }
+
+    t->spi = obj->spi;
+    t->tx = (const uint8_t*)tx;
+    t->rx = (uint8_t*)rx;
+    t->width = (bits > 8) ? 2 : 1;
+    t->left = length;
+    t->id = id;
+    t->handler = handler;
+
+    NVIC_SetVector(irq_n, vector);
+    NVIC_EnableIRQ(irq_n);
+
+    while (!ssp_writeable(obj));
+    spi_transfer_send(t);
+    obj->spi->CR2 |= SPI_CR2_RXNEIE | SPI_CR2_ERRIE;
+}
+
+int spi_active(spi_t *obj) {
+    return spi_transfers[spi_transfer_index(obj)].handler != 0;
+}
+
+void spi_abort_asynch(spi_t *obj) {
+    spi_transfer_t *t = &spi_transfers[spi_transfer_index(obj)];
+    obj->spi->CR2 &= ~(SPI_CR2_RXNEIE | SPI_CR2_ERRIE);
+    t->handler = 0;
+    while (ssp_busy(obj));
+    while (ssp_readable(obj)) {
+        (void)obj->spi->DR;
+    }
+}
+
+#endif
+
 #endif
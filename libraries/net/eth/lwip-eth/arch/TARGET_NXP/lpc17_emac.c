@@ -38,6 +38,7 @@
 #include "lpc_emac_config.h"
 #include "lpc_phy.h"
 #include "sys_arch.h"
+#include "mbed_profile.h"
 
 #include "mbed_interface.h"
 #include <string.h>
@@ -403,9 +404,11 @@ void lpc_enetif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
+	MBED_PROFILE_START(lpc_low_level_input);
 
 	/* move received packet into a new pbuf */
 	p = lpc_low_level_input(netif);
+	MBED_PROFILE_STOP(lpc_low_level_input);
 	if (p == NULL)
 		return;
 
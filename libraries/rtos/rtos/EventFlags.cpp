@@ -0,0 +1,66 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "EventFlags.h"
+
+#include <string.h>
+#include "error.h"
+
+namespace rtos {
+
+EventFlags::EventFlags() {
+#ifdef CMSIS_OS_RTX
+    memset(_event_flags_data, 0, sizeof(_event_flags_data));
+    _osEventFlagsDef.event_flags = _event_flags_data;
+#endif
+    _osEventFlagsId = osEventFlagsCreate(&_osEventFlagsDef);
+    if (_osEventFlagsId == NULL) {
+        error("Error initializing the event flags\n");
+    }
+}
+
+uint32_t EventFlags::set(uint32_t flags) {
+    return osEventFlagsSet(_osEventFlagsId, flags);
+}
+
+uint32_t EventFlags::clear(uint32_t flags) {
+    return osEventFlagsClear(_osEventFlagsId, flags);
+}
+
+uint32_t EventFlags::get(void) const {
+    return osEventFlagsGet(_osEventFlagsId);
+}
+
+uint32_t EventFlags::wait_any(uint32_t flags, uint32_t millisec, bool clear) {
+    return osEventFlagsWait(_osEventFlagsId, flags,
+                            osFlagsWaitAny | (clear ? 0 : osFlagsNoClear), millisec);
+}
+
+uint32_t EventFlags::wait_all(uint32_t flags, uint32_t millisec, bool clear) {
+    return osEventFlagsWait(_osEventFlagsId, flags,
+                            osFlagsWaitAll | (clear ? 0 : osFlagsNoClear), millisec);
+}
+
+EventFlags::~EventFlags() {
+    osEventFlagsDelete(_osEventFlagsId);
+}
+
+}
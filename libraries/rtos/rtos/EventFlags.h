@@ -0,0 +1,88 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef EVENTFLAGS_H
+#define EVENTFLAGS_H
+
+#include <stdint.h>
+#include "cmsis_os.h"
+
+namespace rtos {
+
+/** The EventFlags class is used to signal events to any number of threads at once.
+
+  Unlike Thread::signal_set, which targets one thread, the flags belong to the
+  object: every thread whose wait they meet is resumed by the same set, which
+  may come from a thread or an interrupt handler. Flags use bits 0..30.
+*/
+class EventFlags {
+public:
+    /** Create and Initialize an EventFlags object, all flags cleared. */
+    EventFlags();
+
+    /** Set flags, resuming every thread whose wait they meet.
+      @param   flags  flags to set.
+      @return  flags after setting, or an error code with bit 31 set.
+      @note    can be called from ISR.
+    */
+    uint32_t set(uint32_t flags);
+
+    /** Clear flags.
+      @param   flags  flags to clear (default: all).
+      @return  flags before clearing, or an error code with bit 31 set.
+      @note    can be called from ISR.
+    */
+    uint32_t clear(uint32_t flags=0x7FFFFFFF);
+
+    /** Get the current flags.
+      @return  current flags.
+      @note    can be called from ISR.
+    */
+    uint32_t get(void) const;
+
+    /** Wait until any of the specified flags is set.
+      @param   flags     flags to wait for.
+      @param   millisec  timeout value or 0 in case of no time-out. (default: osWaitForever).
+      @param   clear     clear the flags that met the wait (default: true).
+      @return  flags when the wait was met, before clearing, or an error code with bit 31 set.
+    */
+    uint32_t wait_any(uint32_t flags, uint32_t millisec=osWaitForever, bool clear=true);
+
+    /** Wait until all of the specified flags are set.
+      @param   flags     flags to wait for.
+      @param   millisec  timeout value or 0 in case of no time-out. (default: osWaitForever).
+      @param   clear     clear the flags that met the wait (default: true).
+      @return  flags when the wait was met, before clearing, or an error code with bit 31 set.
+    */
+    uint32_t wait_all(uint32_t flags, uint32_t millisec=osWaitForever, bool clear=true);
+
+    ~EventFlags();
+
+private:
+    osEventFlagsId _osEventFlagsId;
+    osEventFlagsDef_t _osEventFlagsDef;
+#ifdef CMSIS_OS_RTX
+    uint32_t _event_flags_data[3];
+#endif
+};
+
+}
+#endif
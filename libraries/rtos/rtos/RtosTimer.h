@@ -62,7 +62,7 @@ private:
     osTimerId _timer_id;
     osTimerDef_t _timer;
 #ifdef CMSIS_OS_RTX
-    uint32_t _timer_data[5];
+    uint32_t _timer_data[7];
 #endif
 };
 
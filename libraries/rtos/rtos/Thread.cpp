@@ -64,6 +64,26 @@ Thread::State Thread::get_state() {
     return ((State)_thread_def.tcb.state);
 }
 
+uint32_t Thread::stack_size() {
+    return osThreadGetInfo(_tid, osThreadInfoStackSize);
+}
+
+uint32_t Thread::free_stack() {
+    return stack_size() - used_stack();
+}
+
+uint32_t Thread::used_stack() {
+    return osThreadGetInfo(_tid, osThreadInfoStackUsed);
+}
+
+uint32_t Thread::max_stack() {
+    return osThreadGetInfo(_tid, osThreadInfoStackMax);
+}
+
+uint64_t Thread::get_cpu_time() {
+    return osThreadGetCpuTime(_tid);
+}
+
 osEvent Thread::signal_wait(int32_t signals, uint32_t millisec) {
     return osSignalWait(signals, millisec);
 }
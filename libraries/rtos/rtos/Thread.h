@@ -76,6 +76,7 @@ public:
         WaitingSemaphore,   /**< Waiting for a semaphore event to occur */
         WaitingMailbox,     /**< Waiting for a mailbox event to occur */
         WaitingMutex,       /**< Waiting for a mutex event to occur */
+        WaitingEventFlags,  /**< Waiting for event flags to be set */
     };
 
     /** State of this Thread
@@ -83,6 +84,33 @@ public:
     */
     State get_state();
 
+    /** Get the total stack memory size for this Thread
+      @return  the total stack memory size in bytes
+    */
+    uint32_t stack_size();
+
+    /** Get the currently unused stack memory for this Thread
+      @return  the currently unused stack memory in bytes
+    */
+    uint32_t free_stack();
+
+    /** Get the currently used stack memory for this Thread
+      @return  the currently used stack memory in bytes
+    */
+    uint32_t used_stack();
+
+    /** Get the maximum stack memory usage to date for this Thread
+      @return  the maximum stack memory usage to date in bytes, 0 when not measured
+      @note  needs OS_STKINIT, the stack being filled with a pattern when the thread starts
+    */
+    uint32_t max_stack();
+
+    /** Get the processor time used by this Thread
+      @return  the run time in microseconds, 0 when OS_TRACE is disabled
+      @note  time spent in interrupt handlers is charged to the thread they interrupted
+    */
+    uint64_t get_cpu_time();
+
     /** Wait for one or more Signal Flags to become signaled for the current RUNNING thread.
       @param   signals   wait until all specified signal flags set or 0 for any single signal flag.
       @param   millisec  timeout value or 0 in case of no time-out. (default: osWaitForever).
@@ -0,0 +1,370 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cmsis_os.h"
+#include "Thread.h"
+#include "Mutex.h"
+#include "Mail.h"
+#include "RtosTimer.h"
+#include "critical.h"
+#include "us_ticker_api.h"
+
+namespace rtos {
+
+/** Statistics of a WorkQueue, times in microseconds */
+typedef struct {
+    uint32_t timestamp;     /**< us_ticker_read() when the statistics were read */
+    uint32_t posted;        /**< jobs accepted, delayed ones included */
+    uint32_t rejected;      /**< jobs refused because the queue was full */
+    uint32_t cancelled;     /**< jobs cancelled before they started */
+    uint32_t completed;     /**< jobs run to completion */
+    uint32_t pending;       /**< jobs due and waiting for a worker */
+    uint32_t max_pending;   /**< peak of pending */
+    uint32_t max_wait;      /**< longest time a job waited for a worker once due */
+    uint64_t wait_time;     /**< total time the completed jobs waited for a worker once due */
+    uint64_t run_time;      /**< total time spent running jobs */
+} work_queue_stats_t;
+
+/** The WorkQueue class runs short jobs on a fixed pool of worker threads.
+ Jobs share the stacks of the workers instead of each having a thread of its own.
+ They are taken by priority, in posting order for the same priority, and
+ a job posted with a delay is queued by an RtosTimer when it is due.
+ Throughput is the difference of work_queue_stats_t::completed between two
+ get_stats() calls over the difference of their timestamps.
+  @tparam  queue_sz  maximum number of jobs posted and not yet started.
+  @tparam  workers   number of worker threads. (default: 1)
+*/
+template<uint32_t queue_sz, uint32_t workers=1>
+class WorkQueue {
+public:
+    /** Create the queue and start its worker threads.
+      @param   priority       priority of the worker threads. (default: osPriorityNormal).
+      @param   stack_size     stack size (in bytes) of each worker thread. (default: DEFAULT_STACK_SIZE).
+      @param   stack_pointer  pointer to workers*stack_size bytes for the stacks, or NULL to allocate them. (default: NULL).
+    */
+    WorkQueue(osPriority priority=osPriorityNormal,
+              uint32_t stack_size=DEFAULT_STACK_SIZE,
+              unsigned char *stack_pointer=NULL) :
+            _timer(&WorkQueue::timer_main, osTimerOnce, this) {
+        memset(_ready_head, 0, sizeof(_ready_head));
+        memset(_ready_tail, 0, sizeof(_ready_tail));
+        _cancelled = NULL;
+        _delayed = NULL;
+        _next_id = 1;
+        memset(&_stats, 0, sizeof(_stats));
+        for (uint32_t i = 0; i < workers; i++) {
+            _workers[i] = new Thread(&WorkQueue::worker_main, this, priority, stack_size,
+                                     stack_pointer ? stack_pointer + i * stack_size : NULL);
+        }
+    }
+
+    /** Post a job to run as soon as a worker is free.
+      @param   task      function run by the job.
+      @param   argument  argument passed to the function. (default: NULL).
+      @param   priority  priority of the job among the queued ones. (default: osPriorityNormal).
+      @return  job ID for WorkQueue::cancel, or 0 if the queue is full or the priority invalid.
+      @note    can be called from ISR.
+    */
+    uint32_t post(void (*task)(void const *argument), void *argument=NULL,
+                  osPriority priority=osPriorityNormal) {
+        Job *job = create(task, argument, priority);
+        if (job == NULL) {
+            return 0;
+        }
+        make_ready(job);
+        return job->id;
+    }
+
+    /** Post a job to run once a delay has elapsed.
+      @param   millisec  delay before the job is due, at most 2000000 ms.
+      @param   task      function run by the job.
+      @param   argument  argument passed to the function. (default: NULL).
+      @param   priority  priority of the job among the queued ones. (default: osPriorityNormal).
+      @return  job ID for WorkQueue::cancel, or 0 if the queue is full or a parameter invalid.
+    */
+    uint32_t post_delayed(uint32_t millisec, void (*task)(void const *argument),
+                          void *argument=NULL, osPriority priority=osPriorityNormal) {
+        if (millisec > MAX_DELAY) {
+            return 0;
+        }
+        Job *job = create(task, argument, priority);
+        if (job == NULL) {
+            return 0;
+        }
+        job->time = us_ticker_read() + millisec * 1000;
+
+        _delayed_lock.lock();
+        Job **link = &_delayed;
+        while ((*link != NULL) && ((int32_t)((*link)->time - job->time) <= 0)) {
+            link = &(*link)->next;
+        }
+        job->next = *link;
+        *link = job;
+        if (_delayed == job) {
+            _timer.start(millisec ? millisec : 1);
+        }
+        _delayed_lock.unlock();
+        return job->id;
+    }
+
+    /** Cancel a job that has not started yet.
+      @param   id  job ID returned by WorkQueue::post or WorkQueue::post_delayed.
+      @return  osOK if cancelled, osErrorResource if the job started, ended or does not exist.
+    */
+    osStatus cancel(uint32_t id) {
+        Job *job = NULL;
+
+        _delayed_lock.lock();
+        for (Job **link = &_delayed; *link != NULL; link = &(*link)->next) {
+            if ((*link)->id == id) {
+                job = *link;
+                *link = job->next;
+                break;
+            }
+        }
+        _delayed_lock.unlock();
+        if (job != NULL) {
+            // Never made ready, so no worker is woken for it
+            _mail.free(job);
+            count_cancel();
+            return osOK;
+        }
+
+        core_util_critical_section_enter();
+        for (uint32_t p = 0; (p < PRIORITIES) && (job == NULL); p++) {
+            Job *prev = NULL;
+            for (Job *it = _ready_head[p]; it != NULL; prev = it, it = it->next) {
+                if (it->id != id) {
+                    continue;
+                }
+                if (prev == NULL) {
+                    _ready_head[p] = it->next;
+                } else {
+                    prev->next = it->next;
+                }
+                if (_ready_tail[p] == it) {
+                    _ready_tail[p] = prev;
+                }
+                // A worker is woken for it: that worker releases it
+                it->next = _cancelled;
+                _cancelled = it;
+                _stats.pending--;
+                _stats.cancelled++;
+                job = it;
+                break;
+            }
+        }
+        core_util_critical_section_exit();
+        return (job != NULL) ? osOK : osErrorResource;
+    }
+
+    /** Get the statistics of the queue.
+      @param   stats  structure receiving the statistics.
+    */
+    void get_stats(work_queue_stats_t *stats) {
+        core_util_critical_section_enter();
+        *stats = _stats;
+        stats->timestamp = us_ticker_read();
+        core_util_critical_section_exit();
+    }
+
+    /** Reset the statistics of the queue, pending jobs are still counted. */
+    void reset_stats(void) {
+        core_util_critical_section_enter();
+        uint32_t pending = _stats.pending;
+        memset(&_stats, 0, sizeof(_stats));
+        _stats.pending = pending;
+        _stats.max_pending = pending;
+        core_util_critical_section_exit();
+    }
+
+    /** Stop the worker threads. No job must be running. */
+    ~WorkQueue() {
+        _timer.stop();
+        for (uint32_t i = 0; i < workers; i++) {
+            _workers[i]->terminate();
+            delete _workers[i];
+        }
+    }
+
+private:
+    struct Job {
+        Job *next;
+        void (*task)(void const *argument);
+        void *argument;
+        uint32_t id;
+        uint32_t time;      // due time while delayed, then time it was made ready
+        uint32_t priority;  // index in the ready lists
+    };
+
+    enum {
+        PRIORITIES = osPriorityRealtime - osPriorityIdle + 1,
+        MAX_DELAY  = 2000000
+    };
+
+    Job *create(void (*task)(void const *argument), void *argument, osPriority priority) {
+        if ((task == NULL) || (priority < osPriorityIdle) || (priority > osPriorityRealtime)) {
+            return NULL;
+        }
+        Job *job = _mail.alloc();
+        core_util_critical_section_enter();
+        if (job == NULL) {
+            _stats.rejected++;
+        } else {
+            _stats.posted++;
+            job->id = _next_id++;
+            if (_next_id == 0) {
+                _next_id = 1;
+            }
+        }
+        core_util_critical_section_exit();
+        if (job != NULL) {
+            job->next = NULL;
+            job->task = task;
+            job->argument = argument;
+            job->priority = osPriorityRealtime - priority;
+        }
+        return job;
+    }
+
+    void make_ready(Job *job) {
+        job->next = NULL;
+        job->time = us_ticker_read();
+        core_util_critical_section_enter();
+        if (_ready_tail[job->priority] == NULL) {
+            _ready_head[job->priority] = job;
+        } else {
+            _ready_tail[job->priority]->next = job;
+        }
+        _ready_tail[job->priority] = job;
+        if (++_stats.pending > _stats.max_pending) {
+            _stats.max_pending = _stats.pending;
+        }
+        core_util_critical_section_exit();
+        // Every job put in the ready lists puts one wakeup in the mail queue and
+        // holds its block until a worker takes that wakeup: the queue never fills.
+        _mail.put(job);
+    }
+
+    void count_cancel(void) {
+        core_util_critical_section_enter();
+        _stats.cancelled++;
+        core_util_critical_section_exit();
+    }
+
+    /* A wakeup is not tied to the job it was posted with: the worker runs the
+       highest priority job, or releases a cancelled one if none is ready. */
+    void run_next(void) {
+        Job *job = NULL;
+        bool run = true;
+
+        core_util_critical_section_enter();
+        for (uint32_t p = 0; p < PRIORITIES; p++) {
+            job = _ready_head[p];
+            if (job != NULL) {
+                _ready_head[p] = job->next;
+                if (_ready_head[p] == NULL) {
+                    _ready_tail[p] = NULL;
+                }
+                _stats.pending--;
+                break;
+            }
+        }
+        if ((job == NULL) && (_cancelled != NULL)) {
+            job = _cancelled;
+            _cancelled = job->next;
+            run = false;
+        }
+        core_util_critical_section_exit();
+        if (job == NULL) {
+            return;
+        }
+
+        if (run) {
+            uint32_t start = us_ticker_read();
+            job->task(job->argument);
+            uint32_t end = us_ticker_read();
+            uint32_t wait = start - job->time;
+
+            core_util_critical_section_enter();
+            _stats.completed++;
+            _stats.wait_time += wait;
+            if (wait > _stats.max_wait) {
+                _stats.max_wait = wait;
+            }
+            _stats.run_time += end - start;
+            core_util_critical_section_exit();
+        }
+        _mail.free(job);
+    }
+
+    /* Runs in osTimerThread: makes the due jobs ready and rearms the timer
+       for the next one. */
+    void expire(void) {
+        _delayed_lock.lock();
+        while (_delayed != NULL) {
+            int32_t left = (int32_t)(_delayed->time - us_ticker_read());
+            if (left > 0) {
+                _timer.start((left + 999) / 1000);
+                break;
+            }
+            Job *job = _delayed;
+            _delayed = job->next;
+            make_ready(job);
+        }
+        _delayed_lock.unlock();
+    }
+
+    static void worker_main(void const *argument) {
+        WorkQueue *queue = (WorkQueue *)argument;
+        while (true) {
+            osEvent evt = queue->_mail.get();
+            if (evt.status == osEventMail) {
+                queue->run_next();
+            }
+        }
+    }
+
+    static void timer_main(void const *argument) {
+        ((WorkQueue *)argument)->expire();
+    }
+
+    Mail<Job, queue_sz> _mail;
+    Mutex _delayed_lock;
+    RtosTimer _timer;
+    Thread *_workers[workers];
+    Job *_ready_head[PRIORITIES];
+    Job *_ready_tail[PRIORITIES];
+    Job *_cancelled;
+    Job *_delayed;
+    uint32_t _next_id;
+    work_queue_stats_t _stats;
+};
+
+}
+
+#endif
@@ -26,9 +26,14 @@
 #include "Mutex.h"
 #include "RtosTimer.h"
 #include "Semaphore.h"
+#include "EventFlags.h"
+#include "WorkQueue.h"
 #include "Mail.h"
 #include "MemoryPool.h"
 #include "Queue.h"
+#include "rtos_idle.h"
+#include "rtos_stack.h"
+#include "rtos_trace.h"
 
 using namespace rtos;
 
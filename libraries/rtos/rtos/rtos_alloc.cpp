@@ -0,0 +1,69 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "mbed_alloc.h"
+
+#include "cmsis_os.h"
+#include "cmsis.h"
+#include "critical.h"
+
+/* One mutex for the heap, created by the first thread to allocate once
+ * the kernel runs. Allocating from interrupt handlers is not supported:
+ * they could interrupt a thread holding the heap. */
+
+static int32_t alloc_mutex_data[3];
+static osMutexId volatile alloc_mutex;
+static bool alloc_mutex_claimed;
+
+static bool alloc_lockable(void) {
+    if ((__get_IPSR() != 0) || !osKernelRunning()) {
+        return false;
+    }
+    if (alloc_mutex == NULL) {
+        bool create;
+        core_util_critical_section_enter();
+        create = !alloc_mutex_claimed;
+        alloc_mutex_claimed = true;
+        core_util_critical_section_exit();
+        if (create) {
+            osMutexDef_t def = { alloc_mutex_data };
+            alloc_mutex = osMutexCreate(&def);
+        }
+        // another thread is creating it, possibly one of lower priority:
+        // sleep rather than yield, which only runs threads of the same one
+        while (alloc_mutex == NULL) {
+            osDelay(1);
+        }
+    }
+    return true;
+}
+
+extern "C" void mbed_alloc_lock(void) {
+    if (alloc_lockable()) {
+        osMutexWait(alloc_mutex, osWaitForever);
+    }
+}
+
+extern "C" void mbed_alloc_unlock(void) {
+    if (alloc_lockable()) {
+        osMutexRelease(alloc_mutex);
+    }
+}
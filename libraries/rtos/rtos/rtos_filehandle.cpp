@@ -0,0 +1,55 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "mbed_retarget.h"
+
+#include "cmsis_os.h"
+#include "cmsis.h"
+
+/* One mutex per descriptor for the retarget layer, created when the
+ * descriptor is first handed out and kept for its later uses. */
+
+static int32_t filehandle_mutex_data[MBED_OPEN_MAX][3];
+static osMutexId filehandle_mutex[MBED_OPEN_MAX];
+
+// Mutexes cannot be taken from interrupt handlers or before the kernel runs
+static inline bool filehandle_lockable(int fd) {
+    return (filehandle_mutex[fd] != NULL) && (__get_IPSR() == 0) && osKernelRunning();
+}
+
+extern "C" void mbed_filehandle_lock_init(int fd) {
+    if (filehandle_mutex[fd] == NULL) {
+        osMutexDef_t def = { filehandle_mutex_data[fd] };
+        filehandle_mutex[fd] = osMutexCreate(&def);
+    }
+}
+
+extern "C" void mbed_filehandle_lock(int fd) {
+    if (filehandle_lockable(fd)) {
+        osMutexWait(filehandle_mutex[fd], osWaitForever);
+    }
+}
+
+extern "C" void mbed_filehandle_unlock(int fd) {
+    if (filehandle_lockable(fd)) {
+        osMutexRelease(filehandle_mutex[fd]);
+    }
+}
@@ -0,0 +1,110 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "rtos_idle.h"
+
+#include "cmsis_os.h"
+#include "cmsis.h"
+#include "critical.h"
+#include "TimerEvent.h"
+#include "us_ticker_api.h"
+#include "sleep_api.h"
+
+extern "C" uint32_t rt_psh_pending(void);
+
+namespace rtos {
+
+/* Ticker event waking the core up when the next RTX timeout is due;
+   the interrupt itself is all that is needed. */
+class IdleWakeup : public mbed::TimerEvent {
+public:
+    void schedule(unsigned int timestamp) {
+        insert(timestamp);
+    }
+
+    void cancel() {
+        remove();
+    }
+
+protected:
+    virtual void handler() {}
+};
+
+static uint64_t idle_sleep_time;
+static uint32_t idle_sleep_count;
+
+}
+
+using namespace rtos;
+
+void rtos_idle_loop(uint32_t tick_us) {
+    static IdleWakeup wakeup;
+    uint32_t carry = 0;  // time asleep not yet accounted as a whole tick
+
+    for (;;) {
+        uint32_t ticks = os_suspend();
+        if (ticks < 2) {
+            // the next timeout is on the next tick anyway
+            os_resume(0);
+#if DEVICE_SLEEP
+            sleep();
+#endif
+            continue;
+        }
+
+        uint32_t start = us_ticker_read();
+        wakeup.schedule(start + ticks * tick_us - carry);
+
+        // An interrupt pending from here on wakes the core straight away;
+        // one that already ran and readied a thread must not be slept on.
+        // Masking across the sleep delays no interrupt, so it is done
+        // directly rather than as a (traced) critical section.
+        __disable_irq();
+        if (!rt_psh_pending()) {
+#if DEVICE_SLEEP
+            sleep();
+#else
+            __WFI();
+#endif
+        }
+        __enable_irq();
+
+        wakeup.cancel();
+        uint32_t slept = us_ticker_read() - start;
+        idle_sleep_time += slept;
+        idle_sleep_count++;
+
+        slept += carry;
+        carry = slept % tick_us;
+        os_resume(slept / tick_us);
+    }
+}
+
+uint64_t rtos_idle_sleep_time(void) {
+    core_util_critical_section_enter();
+    uint64_t time = idle_sleep_time;
+    core_util_critical_section_exit();
+    return time;
+}
+
+uint32_t rtos_idle_sleep_count(void) {
+    return idle_sleep_count;
+}
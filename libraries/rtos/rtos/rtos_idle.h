@@ -0,0 +1,52 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RTOS_IDLE_H
+#define RTOS_IDLE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Tickless idle loop, run by the RTX idle thread when OS_TICKLESS is set.
+  The system tick is suspended and the core sleeps until the earliest thread
+  timeout or RTX timer (programmed on the us_ticker), or any other interrupt.
+  @param   tick_us  duration of a system tick in micro-seconds.
+*/
+void rtos_idle_loop(uint32_t tick_us);
+
+/** Get the total time the idle thread spent sleeping in tickless mode
+  @return  idle residency in micro-seconds.
+*/
+uint64_t rtos_idle_sleep_time(void);
+
+/** Get the number of tickless sleeps entered by the idle thread
+  @return  number of sleeps.
+*/
+uint32_t rtos_idle_sleep_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "rtos_stack.h"
+
+#include <stdio.h>
+
+#ifndef RTOS_STACK_REPORT_MAX
+#define RTOS_STACK_REPORT_MAX   16
+#endif
+
+int rtos_stack_get_each(rtos_stack_info_t *info, int count) {
+    osThreadId ids[RTOS_STACK_REPORT_MAX];
+    int n = osThreadEnumerate(ids, RTOS_STACK_REPORT_MAX);
+
+    if (n > RTOS_STACK_REPORT_MAX) n = RTOS_STACK_REPORT_MAX;
+    if (n > count) n = count;
+    for (int i = 0; i < n; i++) {
+        info[i].id = ids[i];
+        info[i].size = osThreadGetInfo(ids[i], osThreadInfoStackSize);
+        info[i].used = osThreadGetInfo(ids[i], osThreadInfoStackUsed);
+        info[i].max = osThreadGetInfo(ids[i], osThreadInfoStackMax);
+    }
+    return n;
+}
+
+void rtos_stack_get_isr(rtos_stack_info_t *info) {
+    info->id = NULL;
+    info->size = os_isr_stack_info(osThreadInfoStackSize);
+    info->used = os_isr_stack_info(osThreadInfoStackUsed);
+    info->max = os_isr_stack_info(osThreadInfoStackMax);
+}
+
+void rtos_stack_report(void) {
+    rtos_stack_info_t info[RTOS_STACK_REPORT_MAX];
+    int n = rtos_stack_get_each(info, RTOS_STACK_REPORT_MAX);
+
+    printf("thread      size  used   max\r\n");
+    for (int i = 0; i < n; i++) {
+        printf("0x%08lx %5lu %5lu %5lu\r\n", (unsigned long)info[i].id, (unsigned long)info[i].size,
+               (unsigned long)info[i].used, (unsigned long)info[i].max);
+    }
+    rtos_stack_get_isr(&info[0]);
+    printf("isr        %5lu %5lu %5lu\r\n", (unsigned long)info[0].size,
+           (unsigned long)info[0].used, (unsigned long)info[0].max);
+}
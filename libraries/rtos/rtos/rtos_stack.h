@@ -0,0 +1,59 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RTOS_STACK_H
+#define RTOS_STACK_H
+
+#include <stdint.h>
+#include "cmsis_os.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Stack usage of a thread or of the interrupt handlers */
+typedef struct {
+    osThreadId id;      /**< thread ID, NULL for the interrupt stack */
+    uint32_t size;      /**< stack size in bytes */
+    uint32_t used;      /**< current usage in bytes */
+    uint32_t max;       /**< peak usage in bytes, 0 when not measured */
+} rtos_stack_info_t;
+
+/** Get the stack usage of every active thread, the idle thread included
+  @param   info   array receiving up to count entries.
+  @param   count  size of the array.
+  @return  number of entries written.
+*/
+int rtos_stack_get_each(rtos_stack_info_t *info, int count);
+
+/** Get the usage of the stack used by the interrupt handlers and the scheduler
+  @param   info   receives the usage, with a NULL id.
+*/
+void rtos_stack_get_isr(rtos_stack_info_t *info);
+
+/** Print the stack usage of every thread and of the interrupt handlers */
+void rtos_stack_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,103 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "rtos_trace.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef RTOS_TRACE_REPORT_MAX
+#define RTOS_TRACE_REPORT_MAX   16
+#endif
+
+#define RTOS_TRACE_VERSION      1
+#define RTOS_TRACE_HEADER_SIZE  16
+#define RTOS_TRACE_THREAD_SIZE  16
+
+int rtos_trace_get_each(rtos_thread_time_t *info, int count) {
+    osThreadId ids[RTOS_TRACE_REPORT_MAX];
+    int n = osThreadEnumerate(ids, RTOS_TRACE_REPORT_MAX);
+
+    if (n > RTOS_TRACE_REPORT_MAX) n = RTOS_TRACE_REPORT_MAX;
+    if (n > count) n = count;
+    for (int i = 0; i < n; i++) {
+        info[i].id = ids[i];
+        info[i].entry = osThreadGetInfo(ids[i], osThreadInfoEntry);
+        info[i].task_id = osThreadGetInfo(ids[i], osThreadInfoTaskId);
+        info[i].state = osThreadGetInfo(ids[i], osThreadInfoState);
+        info[i].priority = osThreadGetPriority(ids[i]);
+        info[i].cpu_time = osThreadGetCpuTime(ids[i]);
+    }
+    return n;
+}
+
+static uint8_t *put_le(uint8_t *p, uint64_t value, int size) {
+    for (int i = 0; i < size; i++) {
+        *p++ = (uint8_t)(value >> (8 * i));
+    }
+    return p;
+}
+
+uint32_t rtos_trace_dump(void *buffer, uint32_t size) {
+    rtos_thread_time_t info[RTOS_TRACE_REPORT_MAX];
+    uint8_t *p = (uint8_t *)buffer;
+    int threads = rtos_trace_get_each(info, RTOS_TRACE_REPORT_MAX);
+    uint32_t used = RTOS_TRACE_HEADER_SIZE + RTOS_TRACE_THREAD_SIZE * threads;
+
+    if (size < used) return 0;
+    // The events are laid out as osTraceEvent, read them in place
+    uint32_t events = osTraceRead((osTraceEvent *)(p + used), (size - used) / sizeof(osTraceEvent));
+
+    memcpy(p, "RTXT", 4);
+    p += 4;
+    *p++ = RTOS_TRACE_VERSION;
+    *p++ = (uint8_t)threads;
+    p = put_le(p, events, 2);
+    p = put_le(p, osTraceClock(), 4);
+    p = put_le(p, osTraceTime(), 4);
+    for (int i = 0; i < threads; i++) {
+        p = put_le(p, info[i].entry, 4);
+        *p++ = info[i].task_id;
+        *p++ = info[i].state;
+        *p++ = (uint8_t)info[i].priority;
+        *p++ = 0;
+        p = put_le(p, info[i].cpu_time, 8);
+    }
+    return used + events * sizeof(osTraceEvent);
+}
+
+void rtos_trace_report(void) {
+    rtos_thread_time_t info[RTOS_TRACE_REPORT_MAX];
+    int n = rtos_trace_get_each(info, RTOS_TRACE_REPORT_MAX);
+    uint64_t total = 0;
+
+    for (int i = 0; i < n; i++) {
+        total += info[i].cpu_time;
+    }
+    if (total == 0) total = 1;
+    printf("thread     entry      id prio     cpu [ms]    %%\r\n");
+    for (int i = 0; i < n; i++) {
+        unsigned long permille = (unsigned long)(info[i].cpu_time * 1000 / total);
+        printf("0x%08lx 0x%08lx %3u %4d %12lu %3lu.%lu\r\n", (unsigned long)info[i].id,
+               (unsigned long)info[i].entry, info[i].task_id, info[i].priority,
+               (unsigned long)(info[i].cpu_time / 1000), permille / 10, permille % 10);
+    }
+}
@@ -0,0 +1,73 @@
+/* mbed Microcontroller Library
+ * Copyright (c) 2006-2012 ARM Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RTOS_TRACE_H
+#define RTOS_TRACE_H
+
+#include <stdint.h>
+#include "cmsis_os.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Processor time used by a thread */
+typedef struct {
+    osThreadId id;          /**< thread ID */
+    uint32_t entry;         /**< address of the thread function */
+    uint8_t task_id;        /**< kernel task ID, as in osTraceEvent */
+    uint8_t state;          /**< thread state, as in Thread::State */
+    int8_t priority;        /**< thread priority, as in osPriority */
+    uint64_t cpu_time;      /**< run time in microseconds */
+} rtos_thread_time_t;
+
+/** Get the processor time used by every active thread, the idle thread included
+  @param   info   array receiving up to count entries.
+  @param   count  size of the array.
+  @return  number of entries written.
+*/
+int rtos_trace_get_each(rtos_thread_time_t *info, int count);
+
+/** Write the threads and the most recent thread switches in a binary format
+ *
+ * All fields are little endian:
+ * - header, 16 bytes: "RTXT", version (1), number of threads, number of
+ *   events (16 bits), time stamp frequency in Hz, current time stamp.
+ * - per thread, 16 bytes: thread function address, task ID, state,
+ *   priority, 0, run time in microseconds (64 bits).
+ * - per event, 8 bytes: an osTraceEvent, oldest first.
+ *
+ * workspace_tools/rtos_trace.py renders it as a timeline.
+ *
+  @param   buffer  receives the dump; the oldest events are left out when it is too small.
+  @param   size    size of the buffer in bytes.
+  @return  number of bytes written, 0 when the buffer cannot hold the header and threads.
+*/
+uint32_t rtos_trace_dump(void *buffer, uint32_t size);
+
+/** Print the processor time used by every thread */
+void rtos_trace_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -94,6 +94,14 @@ void rt_init_stack (P_TCB p_TCB, FUNCP task_body) {
   */
   if (p_TCB->task_id != 0x01)
       p_TCB->stack[0] = MAGIC_WORD;
+
+  /* Fill the free stack with a pattern for the usage watermark, the main
+     thread stack being the heap too. */
+  if (os_stkinit && (p_TCB->task_id != 0x01)) {
+    for (i = 1; &p_TCB->stack[i] < stk; i++) {
+      p_TCB->stack[i] = MAGIC_PATTERN;
+    }
+  }
 }
 
 
@@ -63,19 +63,19 @@ typedef uint32_t OS_RESULT;
 
 #define runtask_id()    rt_tsk_self()
 #define mutex_init(m)   rt_mut_init(m)
-#define mutex_wait(m)   os_mut_wait(m,0xFFFF)
+#define mutex_wait(m)   os_mut_wait(m,0xFFFFFFFF)
 #define mutex_rel(m)    os_mut_release(m)
 
 extern OS_TID    rt_tsk_self    (void);
 extern void      rt_mut_init    (OS_ID mutex);
 extern OS_RESULT rt_mut_release (OS_ID mutex);
-extern OS_RESULT rt_mut_wait    (OS_ID mutex, uint16_t timeout);
+extern OS_RESULT rt_mut_wait    (OS_ID mutex, uint32_t timeout);
 
 #define os_mut_wait(mutex,timeout) _os_mut_wait((uint32_t)rt_mut_wait,mutex,timeout)
 #define os_mut_release(mutex)      _os_mut_release((uint32_t)rt_mut_release,mutex)
 
 OS_RESULT _os_mut_release (uint32_t p, OS_ID mutex)                   __svc_indirect(0);
-OS_RESULT _os_mut_wait    (uint32_t p, OS_ID mutex, uint16_t timeout) __svc_indirect(0);
+OS_RESULT _os_mut_wait    (uint32_t p, OS_ID mutex, uint32_t timeout) __svc_indirect(0);
 
 #endif
 
@@ -94,6 +94,8 @@ uint16_t const os_maxtaskrun = OS_TASK_CNT;
 uint32_t const os_rrobin     = (OS_ROBIN << 16) | OS_ROBINTOUT;
 uint32_t const os_trv        = OS_TRV;
 uint8_t  const os_flags      = OS_RUNPRIV;
+uint8_t  const os_stkinit    = OS_STKINIT;
+uint8_t  const os_trace      = OS_TRACE;
 
 /* Export following defines to uVision debugger. */
 __USED uint32_t const os_clockrate = OS_TICK;
@@ -114,6 +116,18 @@ uint8_t  const os_fifo_size = OS_FIFOSZ;
 /* An array of Active task pointers. */
 void *os_active_TCB[OS_TASK_CNT];
 
+/* Task switch trace buffer, 2 words per event. */
+#if (OS_TRACE != 0) && (OS_TRACECNT != 0)
+#if (OS_TRACECNT & (OS_TRACECNT - 1)) != 0
+#error "OS_TRACECNT must be a power of 2"
+#endif
+uint32_t       os_trace_buf[OS_TRACECNT*2];
+uint16_t const os_trace_size = OS_TRACECNT;
+#else
+uint32_t       os_trace_buf[2];
+uint16_t const os_trace_size = 0;
+#endif
+
 /* User Timers Resources */
 #if (OS_TIMERS != 0)
 extern void osTimerThread (void const *argument);
@@ -275,6 +289,9 @@ void set_main_stack(void) {
 
     // Leave OS_SCHEDULERSTKSIZE words for the scheduler and interrupts
     os_thread_def_main.stacksize = (INITIAL_SP - (unsigned int)HEAP_START) - (OS_SCHEDULERSTKSIZE * 4);
+
+    // Startup code still runs on the interrupt stack
+    os_isr_stack_init((uint32_t *)(INITIAL_SP - (OS_SCHEDULERSTKSIZE * 4)), OS_SCHEDULERSTKSIZE * 4);
 }
 
 #if defined (__CC_ARM)
@@ -48,11 +48,15 @@
 extern U32 idle_task_stack[];
 extern U32 os_fifo[];
 extern void *os_active_TCB[];
+extern U32 os_trace_buf[];
 
 /* Constants */
 extern U16 const os_maxtaskrun;
 extern U32 const os_trv;
 extern U8  const os_flags;
+extern U8  const os_stkinit;
+extern U8  const os_trace;
+extern U16 const os_trace_size;
 extern U32 const os_rrobin;
 extern U32 const os_clockrate;
 extern U32 const os_timernum;
@@ -93,6 +93,35 @@
  #define OS_STKCHECK    1
 #endif
 
+// <q>Stack usage watermark
+// <i> Fills the thread and interrupt stacks with a pattern when they are
+// <i> initialised, so that their peak usage can be read back.
+// <i> Note that additional code slows down thread creation.
+#ifndef OS_STKINIT
+ #define OS_STKINIT     1
+#endif
+
+// <e>Thread run time accounting
+// <i> Accumulates the time each thread runs, timed with the system tick
+// <i> timer at every thread switch.
+// <i> Note that additional code reduces the Kernel performance.
+#ifndef OS_TRACE
+ #define OS_TRACE       1
+#endif
+
+//   <o>Number of thread switches traced <0-1024>
+//   <i> Keeps the most recent thread switches in a ring buffer of
+//   <i> 8 bytes per entry. Must be 0 or a power of 2.
+#ifndef OS_TRACECNT
+#  if   defined(TARGET_LPC11U24) || defined(TARGET_LPC11U35_401)  || defined(TARGET_LPC11U35_501) || defined(TARGET_LPCCAPPUCCINO) || defined(TARGET_LPC1114) \
+	 || defined(TARGET_LPC812)   || defined(TARGET_KL25Z)         || defined(TARGET_KL05Z)        || defined(TARGET_STM32F100RB)  || defined(TARGET_STM32F051R8)
+#    define OS_TRACECNT        0
+#  else
+#    define OS_TRACECNT        64
+#  endif
+#endif
+// </e>
+
 // <o>Processor mode for thread execution
 //   <0=> Unprivileged mode
 //   <1=> Privileged mode
@@ -151,6 +180,14 @@
  #define OS_TICK        1000
 #endif
 
+// <q>Tickless idle
+// <i> When all the threads are blocked, the idle thread stops the system tick
+// <i> and sleeps until the next thread timeout, timer or interrupt.
+// <i> Default: disabled
+#ifndef OS_TICKLESS
+ #define OS_TICKLESS    0
+#endif
+
 // </h>
 
 // <h>System Configuration
@@ -236,10 +273,21 @@
 /*----------------------------------------------------------------------------
  *      OS Idle daemon
  *---------------------------------------------------------------------------*/
+#if OS_TICKLESS
+extern void rtos_idle_loop(uint32_t tick_us);
+#endif
+
 void os_idle_demon (void) {
   /* The idle demon is a system thread, running when no other thread is      */
   /* ready to run.                                                           */
 
+#if OS_TICKLESS
+  /* Suspend the system tick and sleep until the next timeout or interrupt.
+     Note: sleeping usually disconnects the interface chip (debugger), which
+     breaks the local file system.
+  */
+  rtos_idle_loop(OS_TICK);
+#else
   /* Sleep: ideally, we should put the chip to sleep.
      Unfortunately, this usually requires disconnecting the interface chip (debugger).
      This can be done, but it would break the local file system.
@@ -247,6 +295,7 @@ void os_idle_demon (void) {
   for (;;) {
       // sleep();
   }
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -133,6 +133,7 @@ __asm void SVC_Handler (void) {
         IMPORT  SVC_Count
         IMPORT  SVC_Table
         IMPORT  rt_stk_check
+        IMPORT  rt_tsk_switch
 
         MRS     R0,PSP                  ; Read PSP
         LDR     R1,[R0,#24]             ; Read Saved PC from Stack
@@ -174,6 +175,10 @@ __asm void SVC_Handler (void) {
         POP     {R2,R3}
 
 SVC_Next
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           ; Account the task switch
+        POP     {R2,R3}
+
         STR     R2,[R3]                 ; os_tsk.run = os_tsk.new
 
         LDR     R0,[R2,#TCB_TSTACK]     ; os_tsk.new->tsk_stack
@@ -248,6 +253,10 @@ Sys_Switch
         BL      rt_stk_check            ; Check for Stack overflow
         POP     {R2,R3}
 
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           ; Account the task switch
+        POP     {R2,R3}
+
         STR     R2,[R3]                 ; os_tsk.run = os_tsk.new
 
         LDR     R0,[R2,#TCB_TSTACK]     ; os_tsk.new->tsk_stack
@@ -35,7 +35,7 @@
         .file   "HAL_CM0.S"
         .syntax unified
 
-        .equ    TCB_TSTACK, 36
+        .equ    TCB_TSTACK, 40
 
 
 /*----------------------------------------------------------------------------
@@ -223,6 +223,10 @@ SVC_Handler:
         POP     {R2,R3}
 
 SVC_Next:
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           /* Account the task switch */
+        POP     {R2,R3}
+
         STR     R2,[R3]                 /* os_tsk.run = os_tsk.new */
 
         LDR     R0,[R2,#TCB_TSTACK]     /* os_tsk.new->tsk_stack */
@@ -304,6 +308,10 @@ Sys_Switch:
         BL      rt_stk_check            /* Check for Stack overflow */
         POP     {R2,R3}
 
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           /* Account the task switch */
+        POP     {R2,R3}
+
         STR     R2,[R3]                 /* os_tsk.run = os_tsk.new */
 
         LDR     R0,[R2,#TCB_TSTACK]     /* os_tsk.new->tsk_stack */
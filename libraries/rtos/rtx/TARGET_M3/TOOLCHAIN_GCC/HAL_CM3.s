@@ -35,7 +35,7 @@
         .file   "HAL_CM3.S"
         .syntax unified
 
-        .equ    TCB_TSTACK, 36
+        .equ    TCB_TSTACK, 40
 
 
 /*----------------------------------------------------------------------------
@@ -203,6 +203,10 @@ SVC_Handler:
         POP     {R2,R3}
 
 SVC_Next:
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           /* Account the task switch */
+        POP     {R2,R3}
+
         STR     R2,[R3]                 /* os_tsk.run = os_tsk.new */
 
         LDR     R12,[R2,#TCB_TSTACK]    /* os_tsk.new->tsk_stack */
@@ -265,6 +269,10 @@ Sys_Switch:
         BL      rt_stk_check            /* Check for Stack overflow */
         POP     {R2,R3}
 
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           /* Account the task switch */
+        POP     {R2,R3}
+
         STR     R2,[R3]                 /* os_tsk.run = os_tsk.new */
 
         LDR     R12,[R2,#TCB_TSTACK]    /* os_tsk.new->tsk_stack */
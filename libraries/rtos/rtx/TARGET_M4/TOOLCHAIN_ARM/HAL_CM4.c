@@ -123,6 +123,7 @@ __asm void SVC_Handler (void) {
         IMPORT  SVC_Count
         IMPORT  SVC_Table
         IMPORT  rt_stk_check
+        IMPORT  rt_tsk_switch
 
 #ifdef  IFX_XMC4XXX
         EXPORT  SVC_Handler_Veneer
@@ -166,6 +167,10 @@ SVC_Handler_Veneer
         POP     {R2,R3}
 
 SVC_Next
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           ; Account the task switch
+        POP     {R2,R3}
+
         STR     R2,[R3]                 ; os_tsk.run = os_tsk.new
 
         LDR     R12,[R2,#TCB_TSTACK]    ; os_tsk.new->tsk_stack
@@ -248,6 +253,10 @@ Sys_Switch
         BL      rt_stk_check            ; Check for Stack overflow
         POP     {R2,R3}
 
+        PUSH    {R2,R3}
+        BL      rt_tsk_switch           ; Account the task switch
+        POP     {R2,R3}
+
         STR     R2,[R3]                 ; os_tsk.run = os_tsk.new
 
         LDR     R12,[R2,#TCB_TSTACK]    ; os_tsk.new->tsk_stack
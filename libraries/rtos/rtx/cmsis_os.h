@@ -222,6 +222,10 @@ typedef struct os_mutex_cb *osMutexId;
 /// \note CAN BE CHANGED: \b os_semaphore_cb is implementation specific in every CMSIS-RTOS.
 typedef struct os_semaphore_cb *osSemaphoreId;
 
+/// Event Flags ID identifies the event flags (pointer to an event flags control block).
+/// \note Implementation specific.
+typedef struct os_event_flags_cb *osEventFlagsId;
+
 /// Pool ID identifies the memory pool (pointer to a memory pool control block).
 /// \note CAN BE CHANGED: \b os_pool_cb is implementation specific in every CMSIS-RTOS.
 typedef struct os_pool_cb *osPoolId;
@@ -264,6 +268,12 @@ typedef struct os_semaphore_def  {
   void                  *semaphore;    ///< pointer to internal data
 } osSemaphoreDef_t;
 
+/// Event Flags Definition structure contains setup information for event flags.
+/// \note Implementation specific.
+typedef struct os_event_flags_def  {
+  void                 *event_flags;   ///< pointer to internal data
+} osEventFlagsDef_t;
+
 /// Definition structure for memory block allocation.
 /// \note CAN BE CHANGED: \b os_pool_def is implementation specific in every CMSIS-RTOS.
 typedef struct os_pool_def  {
@@ -321,6 +331,16 @@ osStatus osKernelStart (void);
 /// \return 0 RTOS is not started, 1 RTOS is started.
 int32_t osKernelRunning(void);
 
+/// Suspend the scheduler and the system tick, used for tickless idle operation.
+/// \return number of ticks until the next thread timeout or timer expires.
+/// \note Implementation specific: called by the idle thread.
+uint32_t os_suspend (void);
+
+/// Resume the scheduler after a tickless sleep.
+/// \param[in]     sleep_time   number of ticks elapsed while suspended.
+/// \note Implementation specific: called by the idle thread.
+void os_resume (uint32_t sleep_time);
+
 
 //  ==== Thread Management ====
 
@@ -383,6 +403,74 @@ osStatus osThreadSetPriority (osThreadId thread_id, osPriority priority);
 /// \note MUST REMAIN UNCHANGED: \b osThreadGetPriority shall be consistent in every CMSIS-RTOS.
 osPriority osThreadGetPriority (osThreadId thread_id);
 
+/// Thread information read by \ref osThreadGetInfo.
+typedef enum  {
+  osThreadInfoStackSize   =  0,       ///< stack size in bytes
+  osThreadInfoStackMax    =  1,       ///< peak stack usage in bytes, 0 when not measured
+  osThreadInfoStackUsed   =  2,       ///< current stack usage in bytes
+  osThreadInfoTaskId      =  3,       ///< kernel task ID, as recorded in \ref osTraceEvent
+  osThreadInfoEntry       =  4,       ///< address of the thread function
+  osThreadInfoState       =  5        ///< thread state: 1 ready, 2 running, else what it waits for
+} osThreadInfo;
+
+/// Get stack information of an active thread.
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadCreate, \ref osThreadGetId or \ref osThreadEnumerate.
+/// \param[in]     info          information to read.
+/// \return the information, 0 in case of error.
+/// \note Implementation specific: the peak usage needs OS_STKINIT and is not measured for the main thread.
+uint32_t osThreadGetInfo (osThreadId thread_id, osThreadInfo info);
+
+/// Get the thread IDs of the active threads, the idle thread included.
+/// \param[out]    thread_ids    array receiving up to \a count thread IDs.
+/// \param[in]     count         size of the array.
+/// \return number of active threads, which may exceed \a count.
+/// \note Implementation specific.
+uint32_t osThreadEnumerate (osThreadId *thread_ids, uint32_t count);
+
+/// Fill the interrupt stack with the usage watermark pattern.
+/// \param[in]     stack         lowest address of the interrupt stack.
+/// \param[in]     size          size of the interrupt stack in bytes.
+/// \note Implementation specific: called at startup while running on the interrupt stack.
+void os_isr_stack_init (uint32_t *stack, uint32_t size);
+
+/// Get stack information of the interrupt stack.
+/// \param[in]     info          information to read.
+/// \return the information, 0 when the stack was not filled.
+/// \note Implementation specific.
+uint32_t os_isr_stack_info (osThreadInfo info);
+
+/// Get the processor time used by a thread.
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadCreate, \ref osThreadGetId or \ref osThreadEnumerate.
+/// \return run time in microseconds, 0 in case of error or without OS_TRACE.
+/// \note Implementation specific: the time spent in interrupt handlers is charged to the thread they interrupted.
+uint64_t osThreadGetCpuTime (osThreadId thread_id);
+
+/// Thread switch recorded by the kernel, see \ref osTraceRead.
+typedef struct  {
+  uint32_t                   time;    ///< time stamp, see \ref osTraceClock; wraps around
+  uint8_t                    from;    ///< task ID of the thread switched out, 0 when it terminated itself
+  uint8_t                      to;    ///< task ID of the thread switched in
+  uint8_t                   state;    ///< state the thread switched out is left in: ready when preempted or yielding, else what it waits for
+  uint8_t                reserved;
+} osTraceEvent;
+
+/// Get the frequency of the trace time stamps.
+/// \return time stamp counts per second.
+/// \note Implementation specific.
+uint32_t osTraceClock (void);
+
+/// Get the current trace time stamp.
+/// \return time stamp, see \ref osTraceClock.
+/// \note Implementation specific.
+uint32_t osTraceTime (void);
+
+/// Copy the most recent thread switches.
+/// \param[out]    events        array receiving up to \a count events, oldest first.
+/// \param[in]     count         size of the array.
+/// \return number of events copied, 0 without OS_TRACE or OS_TRACECNT.
+/// \note Implementation specific.
+uint32_t osTraceRead (osTraceEvent *events, uint32_t count);
+
 
 //  ==== Generic Wait Functions ====
 
@@ -413,7 +501,7 @@ os_InRegs osEvent osWait (uint32_t millisec);
 extern osTimerDef_t os_timer_def_##name
 #else                            // define the object
 #define osTimerDef(name, function)  \
-uint32_t os_timer_cb_##name[5]; \
+uint32_t os_timer_cb_##name[7]; \
 osTimerDef_t os_timer_def_##name = \
 { (function), (os_timer_cb_##name) }
 #endif
@@ -584,6 +672,76 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id);
 #endif     // Semaphore available
 
 
+//  ==== Event Flags Management Functions ====
+
+/// \note Implementation specific: event flags are shared by several threads, unlike signals.
+
+#define osFlagsWaitAny        0x00000000U ///< wait for any flag (default)
+#define osFlagsWaitAll        0x00000001U ///< wait for all flags
+#define osFlagsNoClear        0x00000002U ///< do not clear the flags that met the wait
+
+#define osFlagsError          0x80000000U ///< error indicator, flags use bits 0..30
+#define osFlagsErrorTimeout   0xFFFFFFFEU ///< timeout, or flags not met without timeout
+#define osFlagsErrorResource  0xFFFFFFFDU ///< event flags deleted while waiting
+#define osFlagsErrorParameter 0xFFFFFFFCU ///< incorrect parameters
+#define osFlagsErrorISR       0xFFFFFFFAU ///< not allowed in ISR
+
+/// Define an Event Flags object.
+/// \param         name          name of the event flags object.
+#if defined (osObjectsExternal)  // object is external
+#define osEventFlagsDef(name)  \
+extern osEventFlagsDef_t os_event_flags_def_##name
+#else                            // define the object
+#define osEventFlagsDef(name)  \
+uint32_t os_event_flags_cb_##name[3]; \
+osEventFlagsDef_t os_event_flags_def_##name = { (os_event_flags_cb_##name) }
+#endif
+
+/// Access an Event Flags definition.
+/// \param         name          name of the event flags object.
+#define osEventFlags(name)  \
+&os_event_flags_def_##name
+
+/// Create and Initialize an Event Flags object, all flags cleared.
+/// \param[in]     event_flags_def  event flags definition referenced with \ref osEventFlags.
+/// \return event flags ID for reference by other functions or NULL in case of error.
+osEventFlagsId osEventFlagsCreate (osEventFlagsDef_t *event_flags_def);
+
+/// Set Event Flags and resume every thread whose wait they meet.
+/// \param[in]     ef_id         event flags ID obtained by \ref osEventFlagsCreate.
+/// \param[in]     flags         flags to set.
+/// \return event flags after setting, or an error code with bit 31 set.
+/// \note Can be called from ISR, which costs the same whatever the number of waiting threads.
+uint32_t osEventFlagsSet (osEventFlagsId ef_id, uint32_t flags);
+
+/// Clear Event Flags.
+/// \param[in]     ef_id         event flags ID obtained by \ref osEventFlagsCreate.
+/// \param[in]     flags         flags to clear.
+/// \return event flags before clearing, or an error code with bit 31 set.
+/// \note Can be called from ISR.
+uint32_t osEventFlagsClear (osEventFlagsId ef_id, uint32_t flags);
+
+/// Get the current Event Flags.
+/// \param[in]     ef_id         event flags ID obtained by \ref osEventFlagsCreate.
+/// \return current event flags, 0 in case of incorrect parameters.
+/// \note Can be called from ISR.
+uint32_t osEventFlagsGet (osEventFlagsId ef_id);
+
+/// Wait for one or all of the specified Event Flags to become signaled.
+/// \param[in]     ef_id         event flags ID obtained by \ref osEventFlagsCreate.
+/// \param[in]     flags         flags to wait for.
+/// \param[in]     options       \ref osFlagsWaitAny or \ref osFlagsWaitAll, optionally with \ref osFlagsNoClear.
+/// \param[in]     millisec      timeout value or 0 in case of no time-out.
+/// \return event flags when the wait was met, before clearing the flags waited for, or an error code with bit 31 set.
+/// \note Can be called from ISR with a \a millisec of 0.
+uint32_t osEventFlagsWait (osEventFlagsId ef_id, uint32_t flags, uint32_t options, uint32_t millisec);
+
+/// Delete an Event Flags object, the waiting threads resume with \ref osFlagsErrorResource.
+/// \param[in]     ef_id         event flags ID obtained by \ref osEventFlagsCreate.
+/// \return status code that indicates the execution status of the function.
+osStatus osEventFlagsDelete (osEventFlagsId ef_id);
+
+
 //  ==== Memory Pool Management Functions ====
 
 #if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0))  // Memory Pool Management available
@@ -24,7 +24,7 @@ typedef struct OS_TCB {
   struct OS_TCB *p_rlnk;          /* Link pointer for sem./mbx lst backwards */
   struct OS_TCB *p_dlnk;          /* Link pointer for delay list             */
   struct OS_TCB *p_blnk;          /* Link pointer for delay list backwards   */
-  U16    delta_time;              /* Time until time out                     */
+  U32    wake_time;               /* System time of the time out             */
   U16    interval_time;           /* Time interval for periodic waits        */
   U16    events;                  /* Event flags                             */
   U16    waits;                   /* Wait flags                              */
@@ -45,6 +45,9 @@ typedef struct OS_TCB {
 
   /* Task entry point used for uVision debugger                              */
   FUNCP  ptask;                   /* Task entry address                      */
+
+  /* Run time accounting                                                      */
+  U64    run_time;                /* Time run, in system timer counts        */
 } *P_TCB;
 
 #endif
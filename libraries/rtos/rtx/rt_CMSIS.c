@@ -55,6 +55,7 @@
 #include "rt_Time.h"
 #include "rt_Mutex.h"
 #include "rt_Semaphore.h"
+#include "rt_EvtFlags.h"
 #include "rt_Mailbox.h"
 #include "rt_MemBox.h"
 #include "rt_HAL_CM.h"
@@ -400,11 +401,13 @@ extern osMessageQId    osMessageQId_osTimerMessageQ;
 static uint32_t rt_ms2tick (uint32_t millisec) {
   uint32_t tick;
 
-  if (millisec == osWaitForever) return 0xFFFF; // Indefinite timeout
-  if (millisec > 4000000) return 0xFFFE;        // Max ticks supported
+  if (millisec == osWaitForever) return 0xFFFFFFFF; // Indefinite timeout
 
-  tick = ((1000 * millisec) + os_clockrate - 1)  / os_clockrate;
-  if (tick > 0xFFFE) return 0xFFFE;
+  // (1000 * millisec) / os_clockrate rounded up, without overflow
+  tick = millisec / os_clockrate;
+  if (tick > OS_DLY_MAX / 1000) return OS_DLY_MAX;  // Max ticks supported
+  tick = (tick * 1000) + (((millisec % os_clockrate) * 1000) + os_clockrate - 1) / os_clockrate;
+  if (tick > OS_DLY_MAX) return OS_DLY_MAX;
 
   return tick;
 }
@@ -456,6 +459,8 @@ uint8_t os_running;                             // Kernel Running flag
 SVC_0_1(svcKernelInitialize, osStatus, RET_osStatus)
 SVC_0_1(svcKernelStart,      osStatus, RET_osStatus)
 SVC_0_1(svcKernelRunning,    int32_t,  RET_int32_t)
+SVC_0_1(svcKernelSuspend,    uint32_t, RET_int32_t)
+SVC_1_1(svcKernelResume,     osStatus, uint32_t, RET_osStatus)
 
 extern void  sysThreadError   (osStatus status);
 osThreadId   svcThreadCreate  (osThreadDef_t *thread_def, void *argument);
@@ -502,6 +507,17 @@ int32_t svcKernelRunning(void) {
   return os_running;
 }
 
+/// Suspend the scheduler for a tickless sleep
+uint32_t svcKernelSuspend (void) {
+  return rt_suspend();
+}
+
+/// Resume the scheduler after a tickless sleep
+osStatus svcKernelResume (uint32_t sleep_time) {
+  rt_resume(sleep_time);
+  return osOK;
+}
+
 // Kernel Control Public API
 
 /// Initialize the RTOS Kernel for creating objects
@@ -556,6 +572,18 @@ int32_t osKernelRunning(void) {
   }
 }
 
+/// Suspend the scheduler, returning the number of ticks until the next timeout
+uint32_t os_suspend (void) {
+  if (__get_IPSR() != 0) return 0;              // Not allowed in ISR
+  return __svcKernelSuspend();
+}
+
+/// Resume the scheduler after sleep_time ticks spent suspended
+void os_resume (uint32_t sleep_time) {
+  if (__get_IPSR() != 0) return;                // Not allowed in ISR
+  __svcKernelResume(sleep_time);
+}
+
 
 // ==== Thread Management ====
 
@@ -568,6 +596,8 @@ SVC_1_1(svcThreadTerminate,   osStatus,   osThreadId,                  RET_osSta
 SVC_0_1(svcThreadYield,       osStatus,                                RET_osStatus)
 SVC_2_1(svcThreadSetPriority, osStatus,   osThreadId,      osPriority, RET_osStatus)
 SVC_1_1(svcThreadGetPriority, osPriority, osThreadId,                  RET_osPriority)
+SVC_2_1(svcThreadGetInfo,     uint32_t,   osThreadId,      osThreadInfo, RET_int32_t)
+SVC_2_1(svcThreadEnumerate,   uint32_t,   osThreadId *,    uint32_t,   RET_int32_t)
 
 // Thread Service Calls
 extern OS_TID rt_get_TID (void);
@@ -674,6 +704,58 @@ osPriority svcThreadGetPriority (osThreadId thread_id) {
   return (osPriority)(ptcb->prio - 1 + osPriorityIdle);
 }
 
+/// Peak usage of a stack filled with MAGIC_PATTERN above its first word
+static uint32_t rt_stack_max (U32 *stack, U32 size) {
+  U32 i;
+
+  for (i = 1; (i < size / 4) && (stack[i] == MAGIC_PATTERN); i++);
+  return size - i * 4;
+}
+
+/// Get stack information of a thread
+uint32_t svcThreadGetInfo (osThreadId thread_id, osThreadInfo info) {
+  P_TCB ptcb;
+
+  ptcb = rt_tid2ptcb(thread_id);                // Get TCB pointer
+  if ((ptcb == NULL) || (ptcb->state == INACTIVE)) return 0;
+
+  if (info == osThreadInfoTaskId) return ptcb->task_id;
+  if (info == osThreadInfoEntry)  return (U32)ptcb->ptask;
+  if (info == osThreadInfoState)  return ptcb->state;
+  if (ptcb->stack == NULL) return 0;
+
+  switch (info) {
+    case osThreadInfoStackSize:
+      return ptcb->priv_stack;
+    case osThreadInfoStackMax:
+      // The main thread stack is shared with the heap and not filled
+      if (!os_stkinit || (ptcb->task_id == 0x01)) return 0;
+      return rt_stack_max(ptcb->stack, ptcb->priv_stack);
+    case osThreadInfoStackUsed:
+      // The calling thread is running on its stack, the others saved it
+      if (ptcb == os_tsk.run) return (U32)&ptcb->stack[ptcb->priv_stack / 4] - __get_PSP();
+      return (U32)&ptcb->stack[ptcb->priv_stack / 4] - ptcb->tsk_stack;
+    default:
+      break;
+  }
+  return 0;
+}
+
+/// Get the IDs of the active threads
+uint32_t svcThreadEnumerate (osThreadId *thread_ids, uint32_t count) {
+  uint32_t i, n;
+
+  n = 0;
+  if (count > 0) thread_ids[n] = &os_idle_TCB;
+  n++;
+  for (i = 0; i < os_maxtaskrun; i++) {
+    if (os_active_TCB[i] == NULL) continue;
+    if (n < count) thread_ids[n] = (P_TCB)os_active_TCB[i];
+    n++;
+  }
+  return n;
+}
+
 
 // Thread Public API
 
@@ -718,6 +800,117 @@ osPriority osThreadGetPriority (osThreadId thread_id) {
   return __svcThreadGetPriority(thread_id);
 }
 
+/// Get stack information of a thread
+uint32_t osThreadGetInfo (osThreadId thread_id, osThreadInfo info) {
+  if (__get_IPSR() != 0) return 0;              // Not allowed in ISR
+  return __svcThreadGetInfo(thread_id, info);
+}
+
+/// Get the IDs of the active threads
+uint32_t osThreadEnumerate (osThreadId *thread_ids, uint32_t count) {
+  if (__get_IPSR() != 0) return 0;              // Not allowed in ISR
+  return __svcThreadEnumerate(thread_ids, count);
+}
+
+static U32 *os_isr_stack;
+static U32  os_isr_stack_size;
+
+/// Fill the interrupt stack below the current stack pointer
+void os_isr_stack_init (uint32_t *stack, uint32_t size) {
+  U32 *p;
+  U32 *end = (U32 *)__get_MSP() - 8;            // Margin for this call
+
+  if (!os_stkinit) return;
+  if (end > stack + size / 4) end = stack + size / 4;
+  for (p = stack + 1; p < end; p++) {
+    *p = MAGIC_PATTERN;
+  }
+  os_isr_stack      = stack;
+  os_isr_stack_size = size;
+}
+
+/// Get stack information of the interrupt stack
+uint32_t os_isr_stack_info (osThreadInfo info) {
+  if (os_isr_stack == NULL) return 0;
+  switch (info) {
+    case osThreadInfoStackSize:
+      return os_isr_stack_size;
+    case osThreadInfoStackMax:
+      return rt_stack_max(os_isr_stack, os_isr_stack_size);
+    case osThreadInfoStackUsed:
+      return (U32)&os_isr_stack[os_isr_stack_size / 4] - __get_MSP();
+    default:
+      break;
+  }
+  return 0;
+}
+
+/// Convert system timer counts to microseconds
+static uint64_t rt_cnt2us (U64 cnt) {
+  return (cnt / (os_trv + 1)) * os_clockrate + (cnt % (os_trv + 1)) * os_clockrate / (os_trv + 1);
+}
+
+/// Get the processor time used by a thread
+uint64_t osThreadGetCpuTime (osThreadId thread_id) {
+  P_TCB ptcb;
+  U64 run_time;
+  U32 num, tick, cnt;
+
+  if (!os_trace) return 0;
+  ptcb = rt_tid2ptcb(thread_id);                // Get TCB pointer
+  if ((ptcb == NULL) || (ptcb->state == INACTIVE)) return 0;
+
+  // Lock free: read again when a thread switch updated the figures
+  do {
+    num = os_switches;
+    run_time = ptcb->run_time;
+    if (ptcb == os_tsk.run) {
+      cnt = rt_time_stamp(&tick);
+      run_time += (U64)(tick - os_swtick) * (os_trv + 1) + cnt - os_swcnt;
+    }
+  } while (num != *(volatile U32 *)&os_switches);
+  return rt_cnt2us(run_time);
+}
+
+/// Get the frequency of the trace time stamps
+uint32_t osTraceClock (void) {
+  return (uint32_t)((U64)(os_trv + 1) * 1000000 / os_clockrate);
+}
+
+/// Get the current trace time stamp
+uint32_t osTraceTime (void) {
+  U32 tick, cnt;
+
+  cnt = rt_time_stamp(&tick);
+  return tick * (os_trv + 1) + cnt;
+}
+
+/// Copy the most recent thread switches, oldest first
+uint32_t osTraceRead (osTraceEvent *events, uint32_t count) {
+  P_TEV trace = (P_TEV)os_trace_buf;
+  U32 num, first, lost, n, i;
+
+  if (!os_trace || (os_trace_size == 0)) return 0;
+
+  num = *(volatile U32 *)&os_switches;
+  n = (num < os_trace_size) ? num : os_trace_size;
+  if (n > count) n = count;
+  first = num - n;
+  for (i = 0; i < n; i++) {
+    events[i] = *(osTraceEvent *)&trace[(first + i) & (os_trace_size - 1)];
+  }
+
+  // Lock free: drop the events overwritten by switches during the copy
+  lost = *(volatile U32 *)&os_switches - first;
+  if (lost <= os_trace_size) return n;
+  lost -= os_trace_size;
+  if (lost >= n) return 0;
+  for (i = 0; i < n - lost; i++) {
+    events[i] = events[i + lost];
+  }
+  return n - lost;
+}
+
 /// INTERNAL - Not Public
 /// Auto Terminate Thread on exit (used implicitly when thread exists)
 __NO_RETURN void osThreadExit (void) {
@@ -797,66 +990,54 @@ os_InRegs osEvent osWait (uint32_t millisec) {
 // Timer structures
 
 typedef struct os_timer_cb_ {                   // Timer Control Block
-  struct os_timer_cb_ *next;                    // Pointer to next active Timer
+  struct os_timer_cb_ *next;                    // Pointer to next Timer in wheel slot
+  struct os_timer_cb_ *prev;                    // Pointer to previous Timer in wheel slot
   uint8_t             state;                    // Timer State
   uint8_t              type;                    // Timer Type (Periodic/One-shot)
   uint16_t         reserved;                    // Reserved
-  uint16_t             tcnt;                    // Timer Delay Count
-  uint16_t             icnt;                    // Timer Initial Count
+  uint32_t             time;                    // System time of Timer expiry
+  uint32_t             icnt;                    // Timer Initial Count
   void                 *arg;                    // Timer Function Argument
   osTimerDef_t       *timer;                    // Pointer to Timer definition
 } os_timer_cb;
 
 // Timer variables
-os_timer_cb *os_timer_head;                     // Pointer to first active Timer
+os_timer_cb *os_timer_wheel[OS_DLY_SLOTS];      // Running Timers by expiry time slot
 
 
 // Timer Helper Functions
 
-// Insert Timer into the list sorted by time
+// Insert Timer into the wheel slot of its expiry time
 static void rt_timer_insert (os_timer_cb *pt, uint32_t tcnt) {
-  os_timer_cb *p, *prev;
+  os_timer_cb **slot;
 
-  prev = NULL;
-  p = os_timer_head;
-  while (p != NULL) {
-    if (tcnt < p->tcnt) break;
-    tcnt -= p->tcnt;
-    prev = p;
-    p = p->next;
-  }
-  pt->next = p;
-  pt->tcnt = (uint16_t)tcnt;
-  if (p != NULL) {
-    p->tcnt -= pt->tcnt;
-  }
-  if (prev != NULL) {
-    prev->next = pt;
-  } else {
-    os_timer_head = pt;
+  pt->time = os_time + tcnt;
+  slot = &os_timer_wheel[pt->time & (OS_DLY_SLOTS - 1)];
+  pt->prev = NULL;
+  pt->next = *slot;
+  if (pt->next != NULL) {
+    pt->next->prev = pt;
   }
+  *slot = pt;
 }
 
-// Remove Timer from the list
+// Remove Timer from the wheel
 static int rt_timer_remove (os_timer_cb *pt) {
-  os_timer_cb *p, *prev;
+  os_timer_cb **slot;
 
-  prev = NULL;
-  p = os_timer_head;
-  while (p != NULL) {
-    if (p == pt) break;
-    prev = p;
-    p = p->next;
-  }
-  if (p == NULL) return -1;
-  if (prev != NULL) {
-    prev->next = pt->next;
+  slot = &os_timer_wheel[pt->time & (OS_DLY_SLOTS - 1)];
+  if (pt->prev != NULL) {
+    pt->prev->next = pt->next;
+  } else if (*slot == pt) {
+    *slot = pt->next;
   } else {
-    os_timer_head = pt->next;
+    return -1;
   }
   if (pt->next != NULL) {
-    pt->next->tcnt += pt->tcnt;
+    pt->next->prev = pt->prev;
   }
+  pt->next = NULL;
+  pt->prev = NULL;
 
   return 0;
 }
@@ -919,6 +1100,7 @@ osStatus svcTimerStart (osTimerId timer_id, uint32_t millisec) {
 
   tcnt = rt_ms2tick(millisec);
   if (tcnt == 0) return osErrorValue;
+  if (tcnt > OS_DLY_MAX) tcnt = OS_DLY_MAX;
 
   switch (pt->state) {
     case osTimerRunning:
@@ -928,7 +1110,7 @@ osStatus svcTimerStart (osTimerId timer_id, uint32_t millisec) {
       break;
     case osTimerStopped:
       pt->state = osTimerRunning;
-      pt->icnt  = (uint16_t)tcnt;
+      pt->icnt  = tcnt;
       break;
     default:
       return osErrorResource;
@@ -999,27 +1181,63 @@ os_InRegs osCallback_type svcTimerCall (osTimerId timer_id) {
 
 static __INLINE osStatus isrMessagePut (osMessageQId queue_id, uint32_t info, uint32_t millisec);
 
-/// Timer Tick (called each SysTick)
-void sysTimerTick (void) {
+// Expire the Timers of a wheel slot that are due
+static void rt_timer_check (os_timer_cb **slot) {
   os_timer_cb *pt, *p;
 
-  p = os_timer_head;
-  if (p == NULL) return;
-
-  p->tcnt--;
-  while ((p != NULL) && (p->tcnt == 0)) {
+  p = *slot;
+  while (p != NULL) {
     pt = p;
     p = p->next;
-    os_timer_head = p;
-    isrMessagePut(osMessageQId_osTimerMessageQ, (uint32_t)pt, 0);
-    if (pt->type == osTimerPeriodic) {
-      rt_timer_insert(pt, pt->icnt);
-    } else {
-      pt->state = osTimerStopped;
+    if ((int32_t)(pt->time - os_time) <= 0) {
+      rt_timer_remove(pt);
+      isrMessagePut(osMessageQId_osTimerMessageQ, (uint32_t)pt, 0);
+      if (pt->type == osTimerPeriodic) {
+        rt_timer_insert(pt, pt->icnt);
+      } else {
+        pt->state = osTimerStopped;
+      }
     }
   }
 }
 
+/// Timer Tick (called each SysTick)
+void sysTimerTick (void) {
+  rt_timer_check(&os_timer_wheel[os_time & (OS_DLY_SLOTS - 1)]);
+}
+
+
+/// Get user timers wake-up time (used by rt_suspend)
+uint32_t sysUserTimerWakeupTime (void) {
+  os_timer_cb *pt;
+  uint32_t     i;
+  int32_t      delta, next = 0xFFFF;
+
+  for (i = 0; i < OS_DLY_SLOTS; i++) {
+    for (pt = os_timer_wheel[i]; pt != NULL; pt = pt->next) {
+      delta = (int32_t)(pt->time - os_time);
+      if (delta < next) {
+        next = (delta > 0) ? delta : 0;
+      }
+    }
+  }
+  return next;
+}
+
+/// Update user timers after a suspend (used by rt_resume)
+void sysUserTimerUpdate (uint32_t sleep_time) {
+  uint32_t time;
+
+  // os_time has already been advanced, check each slot passed once at most
+  if (sleep_time > OS_DLY_SLOTS) {
+    sleep_time = OS_DLY_SLOTS;
+  }
+  time = os_time - sleep_time;
+  while (sleep_time--) {
+    rt_timer_check(&os_timer_wheel[++time & (OS_DLY_SLOTS - 1)]);
+  }
+}
+
 
 // Timer Management Public API
 
@@ -1473,6 +1691,194 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id) {
 }
 
 
+// ==== Event Flags Management ====
+
+// Event Flags Service Calls declarations
+SVC_1_1(svcEventFlagsCreate, osEventFlagsId, const osEventFlagsDef_t *,                     RET_pointer)
+SVC_2_1(svcEventFlagsSet,    uint32_t,       osEventFlagsId, uint32_t,                      RET_int32_t)
+SVC_2_1(svcEventFlagsClear,  uint32_t,       osEventFlagsId, uint32_t,                      RET_int32_t)
+SVC_4_1(svcEventFlagsWait,   uint32_t,       osEventFlagsId, uint32_t, uint32_t, uint32_t,  RET_int32_t)
+SVC_1_1(svcEventFlagsDelete, osStatus,       osEventFlagsId,                                RET_osStatus)
+
+// Event Flags Service Calls
+
+/// Create and Initialize an Event Flags object
+osEventFlagsId svcEventFlagsCreate (const osEventFlagsDef_t *event_flags_def) {
+  OS_ID ef;
+
+  if (event_flags_def == NULL) {
+    sysThreadError(osErrorParameter);
+    return NULL;
+  }
+
+  ef = event_flags_def->event_flags;
+  if (ef == NULL) {
+    sysThreadError(osErrorParameter);
+    return NULL;
+  }
+
+  if (((P_FCB)ef)->cb_type != 0) {
+    sysThreadError(osErrorParameter);
+    return NULL;
+  }
+
+  rt_flg_init(ef);                              // Initialize Event Flags
+
+  return ef;
+}
+
+/// Set Event Flags
+uint32_t svcEventFlagsSet (osEventFlagsId ef_id, uint32_t flags) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osFlagsErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osFlagsErrorParameter;
+
+  if (flags & osFlagsError) return osFlagsErrorParameter;
+
+  return rt_flg_set(ef, flags);                 // Set Event Flags
+}
+
+/// Clear Event Flags
+uint32_t svcEventFlagsClear (osEventFlagsId ef_id, uint32_t flags) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osFlagsErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osFlagsErrorParameter;
+
+  if (flags & osFlagsError) return osFlagsErrorParameter;
+
+  return rt_flg_clear(ef, flags);               // Clear Event Flags
+}
+
+/// Wait for one or all of the specified Event Flags
+uint32_t svcEventFlagsWait (osEventFlagsId ef_id, uint32_t flags, uint32_t options, uint32_t millisec) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osFlagsErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osFlagsErrorParameter;
+
+  if ((flags == 0) || (flags & osFlagsError)) return osFlagsErrorParameter;
+
+  // Wait for Event Flags
+  return rt_flg_wait(ef, flags, (U16)options, rt_ms2tick(millisec));
+}
+
+/// Delete an Event Flags object that was created by osEventFlagsCreate
+osStatus svcEventFlagsDelete (osEventFlagsId ef_id) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osErrorParameter;
+
+  rt_flg_delete(ef);                            // Delete Event Flags
+
+  return osOK;
+}
+
+
+// Event Flags ISR Calls
+
+/// Set Event Flags
+static __INLINE uint32_t isrEventFlagsSet (osEventFlagsId ef_id, uint32_t flags) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osFlagsErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osFlagsErrorParameter;
+
+  if (flags & osFlagsError) return osFlagsErrorParameter;
+
+  return isr_flg_set(ef, flags);                // Set Event Flags
+}
+
+/// Wait for Event Flags without time-out
+static __INLINE uint32_t isrEventFlagsWait (osEventFlagsId ef_id, uint32_t flags, uint32_t options, uint32_t millisec) {
+  OS_ID ef;
+
+  if (millisec != 0) return osFlagsErrorISR;    // Only polling in ISR
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return osFlagsErrorParameter;
+
+  if (((P_FCB)ef)->cb_type != FCB) return osFlagsErrorParameter;
+
+  if ((flags == 0) || (flags & osFlagsError)) return osFlagsErrorParameter;
+
+  // Check Event Flags, never blocks with a zero time-out
+  return rt_flg_wait(ef, flags, (U16)options, 0);
+}
+
+
+// Event Flags Public API
+
+/// Create and Initialize an Event Flags object
+osEventFlagsId osEventFlagsCreate (osEventFlagsDef_t *event_flags_def) {
+  if (__get_IPSR() != 0) return NULL;           // Not allowed in ISR
+  if (((__get_CONTROL() & 1) == 0) && (os_running == 0)) {
+    // Privileged and not running
+    return   svcEventFlagsCreate(event_flags_def);
+  } else {
+    return __svcEventFlagsCreate(event_flags_def);
+  }
+}
+
+/// Set Event Flags
+uint32_t osEventFlagsSet (osEventFlagsId ef_id, uint32_t flags) {
+  if (__get_IPSR() != 0) {                      // in ISR
+    return   isrEventFlagsSet(ef_id, flags);
+  } else {                                      // in Thread
+    return __svcEventFlagsSet(ef_id, flags);
+  }
+}
+
+/// Clear Event Flags
+uint32_t osEventFlagsClear (osEventFlagsId ef_id, uint32_t flags) {
+  if (__get_IPSR() != 0) {                      // in ISR
+    // Clearing never wakes a thread, same service as from a Thread
+    return   svcEventFlagsClear(ef_id, flags);
+  } else {                                      // in Thread
+    return __svcEventFlagsClear(ef_id, flags);
+  }
+}
+
+/// Get the current Event Flags
+uint32_t osEventFlagsGet (osEventFlagsId ef_id) {
+  OS_ID ef;
+
+  ef = rt_id2obj(ef_id);
+  if (ef == NULL) return 0;
+
+  if (((P_FCB)ef)->cb_type != FCB) return 0;
+
+  return ((P_FCB)ef)->flags;
+}
+
+/// Wait for one or all of the specified Event Flags
+uint32_t osEventFlagsWait (osEventFlagsId ef_id, uint32_t flags, uint32_t options, uint32_t millisec) {
+  if (__get_IPSR() != 0) {                      // in ISR
+    return   isrEventFlagsWait(ef_id, flags, options, millisec);
+  } else {                                      // in Thread
+    return __svcEventFlagsWait(ef_id, flags, options, millisec);
+  }
+}
+
+/// Delete an Event Flags object that was created by osEventFlagsCreate
+osStatus osEventFlagsDelete (osEventFlagsId ef_id) {
+  if (__get_IPSR() != 0) return osErrorISR;     // Not allowed in ISR
+  return __svcEventFlagsDelete(ef_id);
+}
+
+
 // ==== Memory Management Functions ====
 
 // Memory Management Helper Functions
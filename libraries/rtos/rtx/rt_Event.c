@@ -48,10 +48,11 @@
 
 /*--------------------------- rt_evt_wait -----------------------------------*/
 
-OS_RESULT rt_evt_wait (U16 wait_flags, U16 timeout, BOOL and_wait) {
+OS_RESULT rt_evt_wait (U16 wait_flags, U32 timeout, BOOL and_wait) {
   /* Wait for one or more event flags with optional time-out.                */
   /* "wait_flags" identifies the flags to wait for.                          */
-  /* "timeout" is the time-out limit in system ticks (0xffff if no time-out) */
+  /* "timeout" is the time-out limit in system ticks (0xffffffff if no       */
+  /* time-out)                                                               */
   /* "and_wait" specifies the AND-ing of "wait_flags" as condition to be met */
   /* to complete the wait. (OR-ing if set to 0).                             */
   U32 block_state;
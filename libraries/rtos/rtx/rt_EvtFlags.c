@@ -0,0 +1,248 @@
+/*----------------------------------------------------------------------------
+ *      RL-ARM - RTX
+ *----------------------------------------------------------------------------
+ *      Name:    RT_EVTFLAGS.C
+ *      Purpose: Implements event flags shared by several tasks
+ *      Rev.:    V4.60
+ *----------------------------------------------------------------------------
+ *
+ * Copyright (c) 1999-2009 KEIL, 2009-2012 ARM Germany GmbH
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  - Neither the name of ARM  nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS AND CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+
+#include "rt_TypeDef.h"
+#include "RTX_Conf.h"
+#include "rt_System.h"
+#include "rt_List.h"
+#include "rt_Task.h"
+#include "rt_EvtFlags.h"
+#include "rt_HAL_CM.h"
+
+
+/*----------------------------------------------------------------------------
+ *      Local Functions
+ *---------------------------------------------------------------------------*/
+
+/*--------------------------- rt_flg_met ------------------------------------*/
+
+static BOOL rt_flg_met (U32 flags, U32 wait_flags, U16 options) {
+  /* Check if "flags" meet a wait for "wait_flags" with "options". */
+  if (options & FLG_WAIT_ALL) {
+    return ((flags & wait_flags) == wait_flags);
+  }
+  return ((flags & wait_flags) != 0);
+}
+
+
+/*--------------------------- rt_flg_chk ------------------------------------*/
+
+static void rt_flg_chk (P_FCB p_FCB) {
+  /* Wake up all the waiting tasks whose wait the flags meet. The waits are  */
+  /* checked against the same flags, the flags that met auto clearing waits */
+  /* are cleared after the last one.                                         */
+  P_TCB p_TCB, p_next;
+  U32 flags, wait_flags, clr;
+
+  flags = p_FCB->flags;
+  clr   = 0;
+  for (p_TCB = p_FCB->p_lnk; p_TCB != NULL; p_TCB = p_next) {
+    p_next = p_TCB->p_lnk;
+    wait_flags = (U32)p_TCB->msg;
+    if (!rt_flg_met (flags, wait_flags, p_TCB->waits)) {
+      continue;
+    }
+    if ((p_TCB->waits & FLG_NO_CLEAR) == 0) {
+      clr |= flags & wait_flags;
+    }
+    /* Unlink the task from the waiting list */
+    p_TCB->p_rlnk->p_lnk = p_next;
+    if (p_next != NULL) {
+      p_next->p_rlnk = p_TCB->p_rlnk;
+    }
+    p_TCB->p_lnk  = NULL;
+    p_TCB->p_rlnk = NULL;
+    rt_ret_val (p_TCB, flags);
+    rt_rmv_dly (p_TCB);
+    p_TCB->state = READY;
+    rt_put_prio (&os_rdy, p_TCB);
+  }
+  if (clr) {
+    rt_and (&p_FCB->flags, ~clr);
+  }
+}
+
+
+/*--------------------------- rt_flg_preempt --------------------------------*/
+
+static void rt_flg_preempt (void) {
+  /* Switch to the highest ready task if it outranks the running task. */
+  P_TCB p_TCB;
+
+  p_TCB = rt_rdy_first ();
+  if (p_TCB && (p_TCB->prio > os_tsk.run->prio)) {
+    /* preempt running task */
+    rt_put_rdy_first (os_tsk.run);
+    os_tsk.run->state = READY;
+    rt_dispatch (NULL);
+  }
+}
+
+
+/*----------------------------------------------------------------------------
+ *      Functions
+ *---------------------------------------------------------------------------*/
+
+
+/*--------------------------- rt_flg_init -----------------------------------*/
+
+void rt_flg_init (OS_ID flags_cb) {
+  /* Initialize an event flags object with all flags cleared */
+  P_FCB p_FCB = flags_cb;
+
+  p_FCB->cb_type = FCB;
+  p_FCB->isr_st  = 0;
+  p_FCB->p_lnk   = NULL;
+  p_FCB->flags   = 0;
+}
+
+
+/*--------------------------- rt_flg_delete ---------------------------------*/
+
+OS_RESULT rt_flg_delete (OS_ID flags_cb) {
+  /* Delete an event flags object, its waiting tasks resume with an error */
+  P_FCB p_FCB = flags_cb;
+  P_TCB p_TCB;
+
+  while (p_FCB->p_lnk != NULL) {
+    p_TCB = rt_get_first ((P_XCB)p_FCB);
+    rt_ret_val (p_TCB, FLG_ERR_DEL);
+    rt_rmv_dly (p_TCB);
+    p_TCB->state = READY;
+    rt_put_prio (&os_rdy, p_TCB);
+  }
+  rt_flg_preempt ();
+
+  p_FCB->cb_type = 0;
+
+  return (OS_R_OK);
+}
+
+
+/*--------------------------- rt_flg_set ------------------------------------*/
+
+U32 rt_flg_set (OS_ID flags_cb, U32 flags) {
+  /* Set "flags" and wake up the tasks whose wait they meet, in one go */
+  P_FCB p_FCB = flags_cb;
+  U32 set;
+
+  rt_or (&p_FCB->flags, flags);
+  set = p_FCB->flags;
+  if (p_FCB->p_lnk != NULL) {
+    rt_flg_chk (p_FCB);
+    rt_flg_preempt ();
+  }
+  return (set);
+}
+
+
+/*--------------------------- rt_flg_clear ----------------------------------*/
+
+U32 rt_flg_clear (OS_ID flags_cb, U32 flags) {
+  /* Clear "flags", return the flags before */
+  P_FCB p_FCB = flags_cb;
+  U32 prev;
+
+  __disable_irq ();
+  prev = p_FCB->flags;
+  p_FCB->flags = prev & ~flags;
+  __enable_irq ();
+  return (prev);
+}
+
+
+/*--------------------------- rt_flg_wait -----------------------------------*/
+
+U32 rt_flg_wait (OS_ID flags_cb, U32 flags, U16 options, U32 timeout) {
+  /* Wait until the flags meet a wait for "flags" with "options", return    */
+  /* the flags at that time.                                                 */
+  P_FCB p_FCB = flags_cb;
+  U32 cur;
+
+  cur = p_FCB->flags;
+  if (rt_flg_met (cur, flags, options)) {
+    if ((options & FLG_NO_CLEAR) == 0) {
+      rt_and (&p_FCB->flags, ~(cur & flags));
+    }
+    return (cur);
+  }
+  if (timeout == 0) {
+    return (FLG_ERR_TMO);
+  }
+  /* Wait flags and options are kept in the TCB until the flags are set */
+  os_tsk.run->msg   = (void **)flags;
+  os_tsk.run->waits = options;
+  rt_put_prio ((P_XCB)p_FCB, os_tsk.run);
+  rt_block (timeout, WAIT_FLG);
+  return (FLG_ERR_TMO);
+}
+
+
+/*--------------------------- isr_flg_set -----------------------------------*/
+
+U32 isr_flg_set (OS_ID flags_cb, U32 flags) {
+  /* Same function as "rt_flg_set", but to be called by ISRs. The waiting   */
+  /* tasks are checked later by the post service: one request is queued at  */
+  /* most, however often the flags are set before it runs.                  */
+  P_FCB p_FCB = flags_cb;
+  U32 set, pending;
+
+  __disable_irq ();
+  set = p_FCB->flags | flags;
+  p_FCB->flags  = set;
+  pending = p_FCB->isr_st;
+  p_FCB->isr_st = 1;
+  __enable_irq ();
+  if (!pending) {
+    rt_psq_enq (p_FCB, 0);
+    rt_psh_req ();
+  }
+  return (set);
+}
+
+
+/*--------------------------- rt_flg_psh ------------------------------------*/
+
+void rt_flg_psh (P_FCB p_CB) {
+  /* Check if tasks have to be waken up */
+  p_CB->isr_st = 0;
+  if (p_CB->p_lnk != NULL) {
+    rt_flg_chk (p_CB);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * end of file
+ *---------------------------------------------------------------------------*/
+
@@ -37,6 +37,7 @@
 #define DEMCR_TRCENA    0x01000000
 #define ITM_ITMENA      0x00000001
 #define MAGIC_WORD      0xE25A2EA5
+#define MAGIC_PATTERN   0xCCCCCCCC
 
 #if defined (__CC_ARM)          /* ARM Compiler */
 
@@ -191,9 +192,13 @@ extern BIT dbg_msg;
 #ifdef __USE_EXCLUSIVE_ACCESS
  #define rt_inc(p)     while(__strex((__ldrex(p)+1),p))
  #define rt_dec(p)     while(__strex((__ldrex(p)-1),p))
+ #define rt_or(p,v)    while(__strex((__ldrex(p)|(v)),p))
+ #define rt_and(p,v)   while(__strex((__ldrex(p)&(v)),p))
 #else
  #define rt_inc(p)     __disable_irq();(*p)++;__enable_irq();
  #define rt_dec(p)     __disable_irq();(*p)--;__enable_irq();
+ #define rt_or(p,v)    __disable_irq();(*p)|=(v);__enable_irq();
+ #define rt_and(p,v)   __disable_irq();(*p)&=(v);__enable_irq();
 #endif
 
 __inline static U32 rt_inc_qi (U32 size, U8 *count, U8 *first) {
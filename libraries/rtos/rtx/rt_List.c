@@ -46,8 +46,17 @@
 
 /* List head of chained ready tasks */
 struct OS_XCB  os_rdy;
-/* List head of chained delay tasks */
-struct OS_XCB  os_dly;
+/* Timing wheel of tasks waiting with a time-out */
+P_TCB os_dly[OS_DLY_SLOTS];
+
+#if OS_RDYBITMAP
+/* Ready lists per priority level, bit 'n' set when level 'n' is not empty */
+U32   os_rdy_map;
+P_TCB os_rdy_first[OS_RDY_LEVELS];
+P_TCB os_rdy_last[OS_RDY_LEVELS];
+/* Index of the highest bit set in a nibble */
+U8 const os_rdy_msb[16] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+#endif
 
 
 /*----------------------------------------------------------------------------
@@ -55,6 +64,46 @@ struct OS_XCB  os_dly;
  *---------------------------------------------------------------------------*/
 
 
+#if OS_RDYBITMAP
+
+/*--------------------------- rt_put_rdy_last -------------------------------*/
+
+static void rt_put_rdy_last (P_TCB p_task) {
+  /* Put task identified with "p_task" at the end of its ready level list.  */
+  U32 level = rt_prio_level (p_task->prio);
+
+  p_task->p_lnk  = NULL;
+  p_task->p_rlnk = NULL;
+  if (os_rdy_map & (1U << level)) {
+    os_rdy_last[level]->p_lnk = p_task;
+  }
+  else {
+    os_rdy_first[level] = p_task;
+    os_rdy_map |= (1U << level);
+  }
+  os_rdy_last[level] = p_task;
+}
+
+
+/*--------------------------- rt_get_rdy_first ------------------------------*/
+
+static P_TCB rt_get_rdy_first (void) {
+  /* Get first task of the highest non empty ready level list. */
+  U32 level = rt_rdy_level ();
+  P_TCB p_first;
+
+  p_first = os_rdy_first[level];
+  os_rdy_first[level] = p_first->p_lnk;
+  if (p_first->p_lnk == NULL) {
+    os_rdy_map &= ~(1U << level);
+  }
+  p_first->p_lnk = NULL;
+  return (p_first);
+}
+
+#endif
+
+
 /*--------------------------- rt_put_prio -----------------------------------*/
 
 void rt_put_prio (P_XCB p_CB, P_TCB p_task) {
@@ -65,7 +114,14 @@ void rt_put_prio (P_XCB p_CB, P_TCB p_task) {
   U32 prio;
   BOOL sem_mbx = __FALSE;
 
-  if (p_CB->cb_type == SCB || p_CB->cb_type == MCB || p_CB->cb_type == MUCB) {
+#if OS_RDYBITMAP
+  if (p_CB == &os_rdy) {
+    rt_put_rdy_last (p_task);
+    return;
+  }
+#endif
+  if (p_CB->cb_type == SCB || p_CB->cb_type == MCB || p_CB->cb_type == MUCB ||
+      p_CB->cb_type == FCB) {
     sem_mbx = __TRUE;
   }
   prio = p_task->prio;
@@ -97,9 +153,15 @@ P_TCB rt_get_first (P_XCB p_CB) {
   /* "p_CB" points to head of list. */
   P_TCB p_first;
 
+#if OS_RDYBITMAP
+  if (p_CB == &os_rdy) {
+    return (rt_get_rdy_first ());
+  }
+#endif
   p_first = p_CB->p_lnk;
   p_CB->p_lnk = p_first->p_lnk;
-  if (p_CB->cb_type == SCB || p_CB->cb_type == MCB || p_CB->cb_type == MUCB) {
+  if (p_CB->cb_type == SCB || p_CB->cb_type == MCB || p_CB->cb_type == MUCB ||
+      p_CB->cb_type == FCB) {
     if (p_first->p_lnk != NULL) {
       p_first->p_lnk->p_rlnk = (P_TCB)p_CB;
       p_first->p_lnk = NULL;
@@ -118,9 +180,24 @@ P_TCB rt_get_first (P_XCB p_CB) {
 void rt_put_rdy_first (P_TCB p_task) {
   /* Put task identified with "p_task" at the head of the ready list. The   */
   /* task must have at least a priority equal to highest priority in list.  */
+#if OS_RDYBITMAP
+  U32 level = rt_prio_level (p_task->prio);
+
+  p_task->p_rlnk = NULL;
+  if (os_rdy_map & (1U << level)) {
+    p_task->p_lnk = os_rdy_first[level];
+  }
+  else {
+    p_task->p_lnk = NULL;
+    os_rdy_last[level] = p_task;
+    os_rdy_map |= (1U << level);
+  }
+  os_rdy_first[level] = p_task;
+#else
   p_task->p_lnk = os_rdy.p_lnk;
   p_task->p_rlnk = NULL;
   os_rdy.p_lnk = p_task;
+#endif
 }
 
 
@@ -131,11 +208,18 @@ P_TCB rt_get_same_rdy_prio (void) {
   /* wise return NULL.                                                      */
   P_TCB p_first;
 
+#if OS_RDYBITMAP
+  p_first = rt_rdy_first ();
+  if (p_first != NULL && p_first->prio == os_tsk.run->prio) {
+    return (rt_get_rdy_first ());
+  }
+#else
   p_first = os_rdy.p_lnk;
   if (p_first->prio == os_tsk.run->prio) {
     os_rdy.p_lnk = os_rdy.p_lnk->p_lnk;
     return (p_first);
   }
+#endif
   return (NULL);
 }
 
@@ -167,80 +251,98 @@ res:rt_rmv_list (p_task);
 
 /*--------------------------- rt_put_dly ------------------------------------*/
 
-void rt_put_dly (P_TCB p_task, U16 delay) {
-  /* Put a task identified with "p_task" into chained delay wait list using */
-  /* a delay value of "delay".                                              */
-  P_TCB p;
-  U32 delta,idelay = delay;
-
-  p = (P_TCB)&os_dly;
-  if (p->p_dlnk == NULL) {
-    /* Delay list empty */
-    delta = 0;
-    goto last;
-  }
-  delta = os_dly.delta_time;
-  while (delta < idelay) {
-    if (p->p_dlnk == NULL) {
-      /* End of list found */
-last: p_task->p_dlnk = NULL;
-      p->p_dlnk = p_task;
-      p_task->p_blnk = p;
-      p->delta_time = (U16)(idelay - delta);
-      p_task->delta_time = 0;
-      return;
-    }
-    p = p->p_dlnk;
-    delta += p->delta_time;
-  }
-  /* Right place found */
-  p_task->p_dlnk = p->p_dlnk;
-  p->p_dlnk = p_task;
-  p_task->p_blnk = p;
+void rt_put_dly (P_TCB p_task, U32 delay) {
+  /* Put a task identified with "p_task" into the delay wheel, it times out */
+  /* "delay" ticks from now.                                                */
+  P_TCB *p_slot;
+
+  p_task->wake_time = os_time + delay;
+  p_slot = &os_dly[p_task->wake_time & (OS_DLY_SLOTS - 1)];
+  p_task->p_dlnk = *p_slot;
+  p_task->p_blnk = (P_TCB)p_slot;
   if (p_task->p_dlnk != NULL) {
     p_task->p_dlnk->p_blnk = p_task;
   }
-  p_task->delta_time = (U16)(delta - idelay);
-  p->delta_time -= p_task->delta_time;
+  *p_slot = p_task;
+}
+
+
+/*--------------------------- rt_chk_dly ------------------------------------*/
+
+static void rt_chk_dly (U32 slot) {
+  /* Remove the tasks of wheel slot "slot" that have timed out.             */
+  P_TCB p_rdy, p_next;
+
+  p_rdy = os_dly[slot];
+  while (p_rdy != NULL) {
+    p_next = p_rdy->p_dlnk;
+    if ((S32)(p_rdy->wake_time - os_time) <= 0) {
+      rt_rmv_dly (p_rdy);
+      if (p_rdy->p_rlnk != NULL) {
+        /* Task is really enqueued, remove task from semaphore/mailbox */
+        /* timeout waiting list. */
+        p_rdy->p_rlnk->p_lnk = p_rdy->p_lnk;
+        if (p_rdy->p_lnk != NULL) {
+          p_rdy->p_lnk->p_rlnk = p_rdy->p_rlnk;
+          p_rdy->p_lnk = NULL;
+        }
+        p_rdy->p_rlnk = NULL;
+      }
+      rt_put_prio (&os_rdy, p_rdy);
+      if (p_rdy->state == WAIT_ITV) {
+        /* Calculate the next time for interval wait. */
+        p_rdy->wake_time = p_rdy->interval_time + os_time;
+      }
+      p_rdy->state = READY;
+    }
+    p_rdy = p_next;
+  }
 }
 
 
 /*--------------------------- rt_dec_dly ------------------------------------*/
 
 void rt_dec_dly (void) {
-  /* Decrement delta time of list head: remove tasks having a value of zero.*/
-  P_TCB p_rdy;
+  /* Wake up the tasks timing out at the current system time.               */
+  rt_chk_dly (os_time & (OS_DLY_SLOTS - 1));
+}
 
-  if (os_dly.p_dlnk == NULL) {
-    return;
+
+/*--------------------------- rt_skip_dly -----------------------------------*/
+
+void rt_skip_dly (U32 ticks) {
+  /* Advance the system time by "ticks" at once and wake up the tasks that  */
+  /* timed out meanwhile: each slot needs to be checked once at most.       */
+  U32 time = os_time;
+
+  os_time += ticks;
+  if (ticks > OS_DLY_SLOTS) {
+    ticks = OS_DLY_SLOTS;
+  }
+  while (ticks--) {
+    rt_chk_dly (++time & (OS_DLY_SLOTS - 1));
   }
-  os_dly.delta_time--;
-  while ((os_dly.delta_time == 0) && (os_dly.p_dlnk != NULL)) {
-    p_rdy = os_dly.p_dlnk;
-    if (p_rdy->p_rlnk != NULL) {
-      /* Task is really enqueued, remove task from semaphore/mailbox */
-      /* timeout waiting list. */
-      p_rdy->p_rlnk->p_lnk = p_rdy->p_lnk;
-      if (p_rdy->p_lnk != NULL) {
-        p_rdy->p_lnk->p_rlnk = p_rdy->p_rlnk;
-        p_rdy->p_lnk = NULL;
+}
+
+
+/*--------------------------- rt_next_dly -----------------------------------*/
+
+U32 rt_next_dly (void) {
+  /* Return the number of ticks until the next time-out, OS_DLY_MAX if no   */
+  /* task is waiting with a time-out.                                       */
+  P_TCB p_task;
+  U32 slot;
+  S32 delta, next = OS_DLY_MAX;
+
+  for (slot = 0; slot < OS_DLY_SLOTS; slot++) {
+    for (p_task = os_dly[slot]; p_task != NULL; p_task = p_task->p_dlnk) {
+      delta = (S32)(p_task->wake_time - os_time);
+      if (delta < next) {
+        next = (delta > 0) ? delta : 0;
       }
-      p_rdy->p_rlnk = NULL;
-    }
-    rt_put_prio (&os_rdy, p_rdy);
-    os_dly.delta_time = p_rdy->delta_time;
-    if (p_rdy->state == WAIT_ITV) {
-      /* Calculate the next time for interval wait. */
-      p_rdy->delta_time = p_rdy->interval_time + (U16)os_time;
-    }
-    p_rdy->state   = READY;
-    os_dly.p_dlnk = p_rdy->p_dlnk;
-    if (p_rdy->p_dlnk != NULL) {
-      p_rdy->p_dlnk->p_blnk =  (P_TCB)&os_dly;
-      p_rdy->p_dlnk = NULL;
     }
-    p_rdy->p_blnk = NULL;
   }
+  return ((U32)next);
 }
 
 
@@ -250,6 +352,9 @@ void rt_rmv_list (P_TCB p_task) {
   /* Remove task identified with "p_task" from ready, semaphore or mailbox  */
   /* waiting list if enqueued.                                              */
   P_TCB p_b;
+#if OS_RDYBITMAP
+  U32 level;
+#endif
 
   if (p_task->p_rlnk != NULL) {
     /* A task is enqueued in semaphore / mailbox waiting list. */
@@ -260,6 +365,39 @@ void rt_rmv_list (P_TCB p_task) {
     return;
   }
 
+#if OS_RDYBITMAP
+  /* The priority may have changed already, search all ready levels. */
+  for (level = 0; level < OS_RDY_LEVELS; level++) {
+    if ((os_rdy_map & (1U << level)) == 0) {
+      continue;
+    }
+    p_b = NULL;
+    if (os_rdy_first[level] != p_task) {
+      p_b = os_rdy_first[level];
+      while (p_b->p_lnk != NULL && p_b->p_lnk != p_task) {
+        p_b = p_b->p_lnk;
+      }
+      if (p_b->p_lnk == NULL) {
+        continue;
+      }
+    }
+    /* Task found, unlink it */
+    if (p_b == NULL) {
+      os_rdy_first[level] = p_task->p_lnk;
+      if (p_task->p_lnk == NULL) {
+        os_rdy_map &= ~(1U << level);
+      }
+    }
+    else {
+      p_b->p_lnk = p_task->p_lnk;
+    }
+    if (os_rdy_last[level] == p_task) {
+      os_rdy_last[level] = p_b;
+    }
+    p_task->p_lnk = NULL;
+    return;
+  }
+#else
   p_b = (P_TCB)&os_rdy;
   while (p_b != NULL) {
     /* Search the ready list for task "p_task" */
@@ -269,28 +407,29 @@ void rt_rmv_list (P_TCB p_task) {
     }
     p_b = p_b->p_lnk;
   }
+#endif
 }
 
 
 /*--------------------------- rt_rmv_dly ------------------------------------*/
 
 void rt_rmv_dly (P_TCB p_task) {
-  /* Remove task identified with "p_task" from delay list if enqueued.      */
-  P_TCB p_b;
+  /* Remove task identified with "p_task" from delay wheel if enqueued.     */
+  P_TCB *p_slot;
 
-  p_b = p_task->p_blnk;
-  if (p_b != NULL) {
+  if (p_task->p_blnk != NULL) {
     /* Task is really enqueued */
-    p_b->p_dlnk = p_task->p_dlnk;
-    if (p_task->p_dlnk != NULL) {
-      /* 'p_task' is in the middle of list */
-      p_b->delta_time += p_task->delta_time;
-      p_task->p_dlnk->p_blnk = p_b;
-      p_task->p_dlnk = NULL;
+    p_slot = &os_dly[p_task->wake_time & (OS_DLY_SLOTS - 1)];
+    if (p_task->p_blnk == (P_TCB)p_slot) {
+      /* 'p_task' is at the head of its slot */
+      *p_slot = p_task->p_dlnk;
     }
     else {
-      /* 'p_task' is at the end of list */
-      p_b->delta_time = 0;
+      p_task->p_blnk->p_dlnk = p_task->p_dlnk;
+    }
+    if (p_task->p_dlnk != NULL) {
+      p_task->p_dlnk->p_blnk = p_task->p_blnk;
+      p_task->p_dlnk = NULL;
     }
     p_task->p_blnk = NULL;
   }
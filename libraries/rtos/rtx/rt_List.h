@@ -40,10 +40,54 @@
 #define SCB             2
 #define MUCB            3
 #define HCB             4
+#define FCB             5
+
+/* Ready list organisation. With OS_RDYBITMAP set to 1 the ready tasks are */
+/* kept in one FIFO list per priority level plus a bitmap of the levels    */
+/* that are not empty: putting a task and getting the highest priority one */
+/* take constant time. Otherwise 'os_rdy' is a single list sorted by prio. */
+#ifndef OS_RDYBITMAP
+ #define OS_RDYBITMAP   0
+#endif
+
+#if OS_RDYBITMAP
+/* CMSIS-RTOS uses priorities 0..7, higher priorities share the top level  */
+#define OS_RDY_LEVELS   8
+
+/* ARMv6-M has no CLZ instruction. The architecture is tested here, as     */
+/* the files include rt_HAL_CM.h, which sets __TARGET_ARCH_6S_M for GCC    */
+/* and IAR, after this header.                                             */
+#if defined (__CC_ARM)
+ #define OS_RDY_NO_CLZ  __TARGET_ARCH_6S_M
+#elif defined (__ICCARM__)
+ #define OS_RDY_NO_CLZ  (__CORE__ == __ARM6M__)
+#elif defined (__CORTEX_M0) || defined (__CORTEX_M0PLUS) || defined (__ARM_ARCH_6M__)
+ #define OS_RDY_NO_CLZ  1
+#else
+ #define OS_RDY_NO_CLZ  0
+#endif
+#endif
+
+/* Tasks waiting with a time-out are kept in a hashed timing wheel: a task */
+/* timing out at system time 't' is chained into slot 't % OS_DLY_SLOTS'.  */
+/* Putting and removing a task take constant time, each tick only walks    */
+/* the slot of the current time. Must be a power of 2.                     */
+#ifndef OS_DLY_SLOTS
+ #define OS_DLY_SLOTS   32
+#endif
+
+/* Longest time-out in ticks, the wheel compares times as signed values    */
+#define OS_DLY_MAX      0x7FFFFFFF
 
 /* Variables */
 extern struct OS_XCB os_rdy;
-extern struct OS_XCB os_dly;
+extern P_TCB os_dly[OS_DLY_SLOTS];
+#if OS_RDYBITMAP
+extern U32   os_rdy_map;
+extern P_TCB os_rdy_first[OS_RDY_LEVELS];
+extern P_TCB os_rdy_last[OS_RDY_LEVELS];
+extern U8 const os_rdy_msb[16];
+#endif
 
 /* Functions */
 extern void  rt_put_prio      (P_XCB p_CB, P_TCB p_task);
@@ -51,14 +95,30 @@ extern P_TCB rt_get_first     (P_XCB p_CB);
 extern void  rt_put_rdy_first (P_TCB p_task);
 extern P_TCB rt_get_same_rdy_prio (void);
 extern void  rt_resort_prio   (P_TCB p_task);
-extern void  rt_put_dly       (P_TCB p_task, U16 delay);
+extern void  rt_put_dly       (P_TCB p_task, U32 delay);
 extern void  rt_dec_dly       (void);
+extern void  rt_skip_dly      (U32 ticks);
+extern U32   rt_next_dly      (void);
 extern void  rt_rmv_list      (P_TCB p_task);
 extern void  rt_rmv_dly       (P_TCB p_task);
 extern void  rt_psq_enq       (OS_ID entry, U32 arg);
 
-/* This is a fast macro generating in-line code */
-#define rt_rdy_prio(void) (os_rdy.p_lnk->prio)
+/* These are fast macros generating in-line code */
+#if OS_RDYBITMAP
+#define rt_prio_level(prio) ((prio) < OS_RDY_LEVELS ? (prio) : OS_RDY_LEVELS - 1)
+#if OS_RDY_NO_CLZ
+/* No CLZ instruction, look the highest level up a nibble at a time */
+#define rt_rdy_level(void) ((os_rdy_map & 0xF0) ? 4 + os_rdy_msb[os_rdy_map >> 4] \
+                                                : os_rdy_msb[os_rdy_map])
+#else
+#define rt_rdy_level(void) (31 - __clz (os_rdy_map))
+#endif
+#define rt_rdy_first(void) (os_rdy_map ? os_rdy_first[rt_rdy_level()] : NULL)
+#define rt_rdy_prio(void)  (os_rdy_first[rt_rdy_level()]->prio)
+#else
+#define rt_rdy_first(void) (os_rdy.p_lnk)
+#define rt_rdy_prio(void)  (os_rdy.p_lnk->prio)
+#endif
 
 
 /*----------------------------------------------------------------------------
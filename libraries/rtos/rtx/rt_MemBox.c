@@ -37,6 +37,7 @@
 #include "rt_System.h"
 #include "rt_MemBox.h"
 #include "rt_HAL_CM.h"
+#include "critical.h"
 
 /*----------------------------------------------------------------------------
  *      Global Functions
@@ -95,14 +96,12 @@ void *rt_alloc_box (void *box_mem) {
   /* Allocate a memory block and return start address. */
   void **free;
 #ifndef __USE_EXCLUSIVE_ACCESS
-  int  irq_dis;
-
-  irq_dis = __disable_irq ();
+  core_util_critical_section_enter ();
   free = ((P_BM) box_mem)->free;
   if (free) {
     ((P_BM) box_mem)->free = *free;
   }
-  if (!irq_dis) __enable_irq ();
+  core_util_critical_section_exit ();
 #else
   do {
     if ((free = (void **)__ldrex(&((P_BM) box_mem)->free)) == 0) {
@@ -139,19 +138,15 @@ void *_calloc_box (void *box_mem)  {
 
 int rt_free_box (void *box_mem, void *box) {
   /* Free a memory block, returns 0 if OK, 1 if box does not belong to box_mem */
-#ifndef __USE_EXCLUSIVE_ACCESS
-  int irq_dis;
-#endif
-
   if (box < box_mem || box >= ((P_BM) box_mem)->end) {
     return (1);
   }
 
 #ifndef __USE_EXCLUSIVE_ACCESS
-  irq_dis = __disable_irq ();
+  core_util_critical_section_enter ();
   *((void **)box) = ((P_BM) box_mem)->free;
   ((P_BM) box_mem)->free = box;
-  if (!irq_dis) __enable_irq ();
+  core_util_critical_section_exit ();
 #else
   do {
     *((void **)box) = (void *)__ldrex(&((P_BM) box_mem)->free);
@@ -84,7 +84,8 @@ OS_RESULT rt_mut_delete (OS_ID mutex) {
     rt_put_prio (&os_rdy, p_TCB);
   }
 
-  if (os_rdy.p_lnk && (os_rdy.p_lnk->prio > os_tsk.run->prio)) {
+  p_TCB = rt_rdy_first ();
+  if (p_TCB && (p_TCB->prio > os_tsk.run->prio)) {
     /* preempt running task */
     rt_put_prio (&os_rdy, os_tsk.run);
     os_tsk.run->state = READY;
@@ -154,7 +155,7 @@ OS_RESULT rt_mut_release (OS_ID mutex) {
 
 /*--------------------------- rt_mut_wait -----------------------------------*/
 
-OS_RESULT rt_mut_wait (OS_ID mutex, U16 timeout) {
+OS_RESULT rt_mut_wait (OS_ID mutex, U32 timeout) {
   /* Wait for a mutex, continue when mutex is free. */
   P_MUCB p_MCB = mutex;
 
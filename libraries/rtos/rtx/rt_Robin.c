@@ -65,9 +65,9 @@ __weak void rt_chk_robin (void) {
   /* Check if Round Robin timeout expired and switch to the next ready task.*/
   P_TCB p_new;
 
-  if (os_robin.task != os_rdy.p_lnk) {
+  if (os_robin.task != rt_rdy_first ()) {
     /* New task was suspended, reset Round Robin timeout. */
-    os_robin.task = os_rdy.p_lnk;
+    os_robin.task = rt_rdy_first ();
     os_robin.time = (U16)os_time + os_robin.tout - 1;
   }
   if (os_robin.time == (U16)os_time) {
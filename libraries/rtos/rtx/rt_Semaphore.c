@@ -75,7 +75,8 @@ OS_RESULT rt_sem_delete (OS_ID semaphore) {
     rt_put_prio (&os_rdy, p_TCB);
   }
 
-  if (os_rdy.p_lnk && (os_rdy.p_lnk->prio > os_tsk.run->prio)) {
+  p_TCB = rt_rdy_first ();
+  if (p_TCB && (p_TCB->prio > os_tsk.run->prio)) {
     /* preempt running task */
     rt_put_prio (&os_rdy, os_tsk.run);
     os_tsk.run->state = READY;
@@ -117,7 +118,7 @@ OS_RESULT rt_sem_send (OS_ID semaphore) {
 
 /*--------------------------- rt_sem_wait -----------------------------------*/
 
-OS_RESULT rt_sem_wait (OS_ID semaphore, U16 timeout) {
+OS_RESULT rt_sem_wait (OS_ID semaphore, U32 timeout) {
   /* Obtain a token; possibly wait for it */
   P_SCB p_SCB = semaphore;
 
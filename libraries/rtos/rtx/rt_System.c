@@ -40,6 +40,7 @@
 #include "rt_List.h"
 #include "rt_Mailbox.h"
 #include "rt_Semaphore.h"
+#include "rt_EvtFlags.h"
 #include "rt_Time.h"
 #include "rt_Robin.h"
 #include "rt_HAL_CM.h"
@@ -73,17 +74,28 @@ __RL_RTX_VER    EQU     0x450
 #endif
 
 
+#ifdef __CMSIS_RTOS
+extern U32  sysUserTimerWakeupTime (void);
+extern void sysUserTimerUpdate (U32 sleep_time);
+#endif
+
 /*--------------------------- rt_suspend ------------------------------------*/
 U32 rt_suspend (void) {
   /* Suspend OS scheduler */
-  U32 delta = 0xFFFF;
+  U32 delta;
+#ifdef __CMSIS_RTOS
+  U32 sleep;
+#endif
 
   rt_tsk_lock();
 
-  if (os_dly.p_dlnk) {
-    delta = os_dly.delta_time;
-  }
-#ifndef __CMSIS_RTOS
+  /* Sleep 0xFFFF ticks at most, the idle task suspends again after that */
+  delta = rt_next_dly ();
+  if (delta > 0xFFFF) delta = 0xFFFF;
+#ifdef __CMSIS_RTOS
+  sleep = sysUserTimerWakeupTime ();
+  if (sleep < delta) delta = sleep;
+#else
   if (os_tmr.next) {
     if (os_tmr.tcnt < delta) delta = os_tmr.tcnt;
   }
@@ -97,7 +109,9 @@ U32 rt_suspend (void) {
 void rt_resume (U32 sleep_time) {
   /* Resume OS scheduler after suspend */
   P_TCB next;
+#ifndef __CMSIS_RTOS
   U32   delta;
+#endif
 
   os_tsk.run->state = READY;
   rt_put_rdy_first (os_tsk.run);
@@ -105,27 +119,12 @@ void rt_resume (U32 sleep_time) {
   os_robin.task = NULL;
 
   /* Update delays. */
-  if (os_dly.p_dlnk) {
-    delta = sleep_time;
-    if (delta >= os_dly.delta_time) {
-      delta   -= os_dly.delta_time;
-      os_time += os_dly.delta_time;
-      os_dly.delta_time = 1;
-      while (os_dly.p_dlnk) {
-        rt_dec_dly();
-        if (delta == 0) break;
-        delta--;
-        os_time++;
-      }
-    } else {
-      os_time           += delta;
-      os_dly.delta_time -= delta;
-    }
-  } else {
-    os_time += sleep_time;
-  }
+  rt_skip_dly (sleep_time);
 
-#ifndef __CMSIS_RTOS
+#ifdef __CMSIS_RTOS
+  /* Check the user timers. */
+  sysUserTimerUpdate (sleep_time);
+#else
   /* Check the user timers. */
   if (os_tmr.next) {
     delta = sleep_time;
@@ -151,6 +150,15 @@ void rt_resume (U32 sleep_time) {
 }
 
 
+/*--------------------------- rt_psh_pending --------------------------------*/
+
+U32 rt_psh_pending (void) {
+  /* Check if a post service request was deferred while the scheduler was */
+  /* locked, i.e. if an ISR made a task ready during rt_suspend.          */
+  return (os_psh_flag);
+}
+
+
 /*--------------------------- rt_tsk_lock -----------------------------------*/
 
 void rt_tsk_lock (void) {
@@ -220,6 +228,10 @@ void rt_pop_req (void) {
       /* Is of MCB type */
       rt_mbx_psh ((P_MCB)p_CB, (void *)os_psq->q[idx].arg);
     }
+    else if (p_CB->cb_type == FCB) {
+      /* Is of FCB type */
+      rt_flg_psh ((P_FCB)p_CB);
+    }
     else {
       /* Must be of SCB type */
       rt_sem_psh ((P_SCB)p_CB);
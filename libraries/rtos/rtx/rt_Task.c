@@ -39,6 +39,7 @@
 #include "rt_List.h"
 #include "rt_MemBox.h"
 #include "rt_Robin.h"
+#include "rt_Time.h"
 #include "rt_HAL_CM.h"
 
 /*----------------------------------------------------------------------------
@@ -51,6 +52,13 @@ struct OS_TSK os_tsk;
 /* Task Control Blocks of idle demon */
 struct OS_TCB os_idle_TCB;
 
+/* Time of the last task switch, as system tick and timer counts */
+U32 os_swtick;
+U32 os_swcnt;
+
+/* Number of task switches, also the sequence number of the next event */
+U32 os_switches;
+
 
 /*----------------------------------------------------------------------------
  *      Local Functions
@@ -92,11 +100,12 @@ void rt_init_context (P_TCB p_TCB, U8 priority, FUNCP task_body) {
   p_TCB->p_rlnk  = NULL;
   p_TCB->p_dlnk  = NULL;
   p_TCB->p_blnk  = NULL;
-  p_TCB->delta_time    = 0;
+  p_TCB->wake_time     = 0;
   p_TCB->interval_time = 0;
   p_TCB->events  = 0;
   p_TCB->waits   = 0;
   p_TCB->stack_frame = 0;
+  p_TCB->run_time = 0;
 
   rt_init_stack (p_TCB, task_body);
 }
@@ -112,6 +121,36 @@ void rt_switch_req (P_TCB p_new) {
 }
 
 
+/*--------------------------- rt_tsk_switch ---------------------------------*/
+
+void rt_tsk_switch (void) {
+  /* Called by the switch handlers before "os_tsk.new_tsk" runs: charge the */
+  /* time since the last switch to the running task and trace the switch.   */
+  P_TCB p_old = os_tsk.run;
+  P_TEV p_ev;
+  U32 tick, cnt;
+
+  if (os_trace == 0) {
+    return;
+  }
+  cnt = rt_time_stamp (&tick);
+  if (p_old != NULL) {
+    p_old->run_time += (U64)(tick - os_swtick) * (os_trv + 1) + cnt - os_swcnt;
+  }
+  os_swtick = tick;
+  os_swcnt  = cnt;
+  if (os_trace_size != 0) {
+    p_ev = &((P_TEV)os_trace_buf)[os_switches & (os_trace_size - 1)];
+    p_ev->time     = tick * (os_trv + 1) + cnt;
+    p_ev->from     = (p_old != NULL) ? p_old->task_id : 0;
+    p_ev->to       = os_tsk.new_tsk->task_id;
+    p_ev->state    = (p_old != NULL) ? p_old->state : INACTIVE;
+    p_ev->reserved = 0;
+  }
+  os_switches++;
+}
+
+
 /*--------------------------- rt_dispatch -----------------------------------*/
 
 void rt_dispatch (P_TCB next_TCB) {
@@ -141,14 +180,14 @@ void rt_dispatch (P_TCB next_TCB) {
 
 /*--------------------------- rt_block --------------------------------------*/
 
-void rt_block (U16 timeout, U8 block_state) {
+void rt_block (U32 timeout, U8 block_state) {
   /* Block running task and choose next ready task.                         */
-  /* "timeout" sets a time-out value or is 0xffff (=no time-out).           */
+  /* "timeout" sets a time-out value or is 0xffffffff (=no time-out).       */
   /* "block_state" defines the appropriate task state */
   P_TCB next_TCB;
 
   if (timeout) {
-    if (timeout < 0xffff) {
+    if (timeout != 0xffffffff) {
       rt_put_dly (os_tsk.run, timeout);
     }
     os_tsk.run->state = block_state;
@@ -283,11 +322,13 @@ void rt_sys_init (FUNCP first_task, U32 prio_stksz, void *stk) {
   /* Set up ready list: initially empty */
   os_rdy.cb_type = HCB;
   os_rdy.p_lnk   = NULL;
-  /* Set up delay list: initially empty */
-  os_dly.cb_type = HCB;
-  os_dly.p_dlnk  = NULL;
-  os_dly.p_blnk  = NULL;
-  os_dly.delta_time = 0;
+#if OS_RDYBITMAP
+  os_rdy_map     = 0;
+#endif
+  /* Set up delay wheel: initially empty */
+  for (i = 0; i < OS_DLY_SLOTS; i++) {
+    os_dly[i] = NULL;
+  }
 
   /* Fix SP and systemvariables to assume idle task is running  */
   /* Transform main program into idle task by assuming idle TCB */
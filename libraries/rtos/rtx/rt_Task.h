@@ -46,6 +46,7 @@
 #define WAIT_SEM        7
 #define WAIT_MBX        8
 #define WAIT_MUT        9
+#define WAIT_FLG        10
 
 /* Return codes */
 #define OS_R_TMO        0x01
@@ -60,11 +61,15 @@
 /* Variables */
 extern struct OS_TSK os_tsk;
 extern struct OS_TCB os_idle_TCB;
+extern U32 os_swtick;
+extern U32 os_swcnt;
+extern U32 os_switches;
 
 /* Functions */
 extern void      rt_switch_req (P_TCB p_new);
+extern void      rt_tsk_switch (void);
 extern void      rt_dispatch   (P_TCB next_TCB);
-extern void      rt_block      (U16 timeout, U8 block_state);
+extern void      rt_block      (U32 timeout, U8 block_state);
 extern void      rt_tsk_pass   (void);
 extern OS_TID    rt_tsk_self   (void);
 extern OS_RESULT rt_tsk_prio   (OS_TID task_id, U8 new_prio);
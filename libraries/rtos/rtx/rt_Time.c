@@ -36,6 +36,7 @@
 #include "RTX_Conf.h"
 #include "rt_Task.h"
 #include "rt_Time.h"
+#include "rt_HAL_CM.h"
 
 /*----------------------------------------------------------------------------
  *      Global Variables
@@ -58,9 +59,30 @@ U32 rt_time_get (void) {
 }
 
 
+/*--------------------------- rt_time_stamp ---------------------------------*/
+
+U32 rt_time_stamp (U32 *p_tick) {
+  /* Get system time as system tick "p_tick" and the system timer counts   */
+  /* elapsed since that tick, for run time accounting.                      */
+  U32 tick, val, ovf;
+
+  do {
+    tick = os_time;
+    val  = NVIC_ST_CURRENT;
+    ovf  = (NVIC_INT_CTRL >> 26) & 1;
+    if (ovf) {
+      /* Timer reloaded, the tick interrupt did not count it yet */
+      val = NVIC_ST_CURRENT;
+    }
+  } while (tick != *(volatile U32 *)&os_time);
+  *p_tick = tick + ovf;
+  return (os_trv - val);
+}
+
+
 /*--------------------------- rt_dly_wait -----------------------------------*/
 
-void rt_dly_wait (U16 delay_time) {
+void rt_dly_wait (U32 delay_time) {
   /* Delay task by "delay_time" */
   rt_block (delay_time, WAIT_DLY);
 }
@@ -71,7 +93,7 @@ void rt_dly_wait (U16 delay_time) {
 void rt_itv_set (U16 interval_time) {
   /* Set interval length and define start of first interval */
   os_tsk.run->interval_time = interval_time;
-  os_tsk.run->delta_time = interval_time + (U16)os_time;
+  os_tsk.run->wake_time = interval_time + os_time;
 }
 
 
@@ -79,11 +101,11 @@ void rt_itv_set (U16 interval_time) {
 
 void rt_itv_wait (void) {
   /* Wait for interval end and define start of next one */
-  U16 delta;
+  U32 delta;
 
-  delta = os_tsk.run->delta_time - (U16)os_time;
-  os_tsk.run->delta_time += os_tsk.run->interval_time;
-  if ((delta & 0x8000) == 0) {
+  delta = os_tsk.run->wake_time - os_time;
+  os_tsk.run->wake_time += os_tsk.run->interval_time;
+  if ((delta & 0x80000000) == 0) {
     rt_block (delta, WAIT_ITV);
   }
 }
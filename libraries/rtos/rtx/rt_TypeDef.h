@@ -40,8 +40,8 @@ typedef U32     OS_TID;
 typedef void    *OS_ID;
 typedef U32     OS_RESULT;
 
-#define TCB_STACKF      32        /* 'stack_frame' offset                    */
-#define TCB_TSTACK      36        /* 'tsk_stack' offset                      */
+#define TCB_STACKF      36        /* 'stack_frame' offset                    */
+#define TCB_TSTACK      40        /* 'tsk_stack' offset                      */
 
 typedef struct OS_PSFE {          /* Post Service Fifo Entry                 */
   void  *id;                      /* Object Identification                   */
@@ -61,6 +61,14 @@ typedef struct OS_TSK {
   P_TCB  new_tsk;                 /* Scheduled task to run                   */
 } *P_TSK;
 
+typedef struct OS_TEV {           /* Task switch trace event                 */
+  U32    time;                    /* Switch time in system timer counts      */
+  U8     from;                    /* Task ID of the task switched out        */
+  U8     to;                      /* Task ID of the task switched in         */
+  U8     state;                   /* State the task switched out is left in  */
+  U8     reserved;
+} *P_TEV;
+
 typedef struct OS_ROBIN {         /* Round Robin Control                     */
   P_TCB  task;                    /* Round Robin task                        */
   U16    time;                    /* Round Robin switch time                 */
@@ -73,7 +81,7 @@ typedef struct OS_XCB {
   struct OS_TCB *p_rlnk;          /* Link pointer for sem./mbx lst backwards */
   struct OS_TCB *p_dlnk;          /* Link pointer for delay list             */
   struct OS_TCB *p_blnk;          /* Link pointer for delay list backwards   */
-  U16    delta_time;              /* Time until time out                     */
+  U32    wake_time;               /* System time of the time out             */
 } *P_XCB;
 
 typedef struct OS_MCB {
@@ -95,6 +103,14 @@ typedef struct OS_SCB {
   struct OS_TCB *p_lnk;           /* Chain of tasks waiting for tokens       */
 } *P_SCB;
 
+typedef struct OS_FCB {
+  U8     cb_type;                 /* Control Block Type                      */
+  U8     isr_st;                  /* Post service request pending            */
+  U16    reserved;
+  struct OS_TCB *p_lnk;           /* Chain of tasks waiting for flags        */
+  U32    flags;                   /* Event flags                             */
+} *P_FCB;
+
 typedef struct OS_MUCB {
   U8     cb_type;                 /* Control Block Type                      */
   U8     prio;                    /* Owner task default priority             */
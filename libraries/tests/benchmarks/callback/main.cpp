@@ -0,0 +1,70 @@
+/* Call overhead of FunctionPointer::call() against Callback<void()>::call()
+ *
+ * Each loop calls an empty function ITERATIONS times through the wrapper,
+ * the cost of an empty loop is subtracted and the time per call is printed
+ * in nanoseconds.
+ */
+#include "mbed.h"
+
+#define ITERATIONS  100000
+
+class Counter {
+public:
+    Counter() : count(0) {}
+    void inc() { count++; }
+    volatile int count;
+};
+
+static volatile int count;
+
+static void inc() {
+    count++;
+}
+
+static void inc_context(Counter *c) {
+    c->count++;
+}
+
+static Timer timer;
+
+template <typename F>
+static int time_loop(F &f) {
+    timer.reset();
+    timer.start();
+    for (int i = 0; i < ITERATIONS; i++) {
+        f.call();
+    }
+    timer.stop();
+    return timer.read_us();
+}
+
+struct Empty {
+    void call() { count++; }
+};
+
+static void report(const char *name, int us, int base_us) {
+    printf("%-32s %6d ns/call\r\n", name, (int)((us - base_us) * 1000LL / ITERATIONS));
+}
+
+int main() {
+    Counter counter;
+
+    Empty empty;
+    int base = time_loop(empty);
+
+    FunctionPointer fp_static(inc);
+    FunctionPointer fp_method(&counter, &Counter::inc);
+    Callback<void()> cb_static(inc);
+    Callback<void()> cb_method(&counter, &Counter::inc);
+    Callback<void()> cb_context(&counter, inc_context);
+
+    report("FunctionPointer (function)", time_loop(fp_static), base);
+    report("FunctionPointer (member)",   time_loop(fp_method), base);
+    report("Callback (function)",        time_loop(cb_static), base);
+    report("Callback (member)",          time_loop(cb_method), base);
+    report("Callback (context)",         time_loop(cb_context), base);
+
+    printf("sizeof(FunctionPointer) = %d, sizeof(Callback<void()>) = %d\r\n",
+           (int)sizeof(FunctionPointer), (int)sizeof(Callback<void()>));
+    while (1);
+}
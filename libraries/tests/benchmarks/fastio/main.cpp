@@ -0,0 +1,66 @@
+/* Toggle rate of DigitalOut and BusOut against FastOut and FastBus
+ *
+ * Each loop writes the output TOGGLES times, the rate is printed in
+ * thousands of writes per second.
+ */
+#include "mbed.h"
+
+#define TOGGLES 100000
+
+#if defined(TARGET_KL25Z)
+#define OUT_PIN  PTD0
+#define BUS_PINS PTC0, PTC1, PTC2, PTC3
+#elif defined(TARGET_STM32F4XX)
+#define OUT_PIN  PA_0
+#define BUS_PINS PB_0, PB_1, PB_2, PB_3
+#else
+#define OUT_PIN  p21
+#define BUS_PINS P2_0, P2_1, P2_2, P2_3
+#endif
+
+DigitalOut digital_out(OUT_PIN);
+FastOut<OUT_PIN> fast_out;
+BusOut bus_out(BUS_PINS);
+FastBus<BUS_PINS> fast_bus;
+
+static Timer timer;
+
+static void report(const char *name, int us) {
+    printf("%-24s %6d kHz\r\n", name, (int)(TOGGLES * 1000LL / us));
+}
+
+int main() {
+    timer.start();
+
+    timer.reset();
+    for (int i = 0; i < TOGGLES; i++) {
+        digital_out.write(i & 1);
+    }
+    report("DigitalOut::write", timer.read_us());
+
+    timer.reset();
+    for (int i = 0; i < TOGGLES; i++) {
+        fast_out.write(i & 1);
+    }
+    report("FastOut::write", timer.read_us());
+
+    timer.reset();
+    for (int i = 0; i < TOGGLES; i++) {
+        fast_out.toggle();
+    }
+    report("FastOut::toggle", timer.read_us());
+
+    timer.reset();
+    for (int i = 0; i < TOGGLES; i++) {
+        bus_out.write(i);
+    }
+    report("BusOut::write", timer.read_us());
+
+    timer.reset();
+    for (int i = 0; i < TOGGLES; i++) {
+        fast_bus.write(i);
+    }
+    report("FastBus::write", timer.read_us());
+
+    while (1);
+}
@@ -0,0 +1,86 @@
+/* TLSF heap against the C library heap
+ *
+ * The same pseudo-random run of allocations and frees, of 8 to 264
+ * bytes, goes to malloc()/free() and to mbed_alloc_malloc()/
+ * mbed_alloc_free(). Printed are the fastest, average and slowest
+ * call of each, the spread between the last two being what the TLSF heap
+ * bounds, and the TLSF heap statistics at the end of the run.
+ *
+ * Built with MBED_HEAP_TLSF both sides are the TLSF heap.
+ */
+#include "mbed.h"
+#include "mbed_alloc.h"
+#include "mbed_profile.h"
+
+#define SLOTS           32
+#define OPERATIONS      4000
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t total;
+} timing_t;
+
+static void *slots[SLOTS];
+
+static void timing_add(timing_t *t, uint32_t time) {
+    t->count++;
+    t->total += time;
+    if (time < t->min) t->min = time;
+    if (time > t->max) t->max = time;
+}
+
+static void timing_print(const char *name, const timing_t *t) {
+    printf("  %-6s %6u %6u %6u " MBED_PROFILE_UNIT "\r\n", name, (unsigned)t->min,
+           (unsigned)(t->count ? t->total / t->count : 0), (unsigned)t->max);
+}
+
+static void run(const char *name, void *(*alloc)(size_t), void (*release)(void *)) {
+    timing_t alloc_time = { 0, 0xFFFFFFFF, 0, 0 };
+    timing_t free_time = { 0, 0xFFFFFFFF, 0, 0 };
+    uint32_t failed = 0;
+    uint32_t seed = 12345;
+
+    for (int i = 0; i < OPERATIONS; i++) {
+        seed = seed * 1103515245 + 12345;
+        int slot = (seed >> 16) % SLOTS;
+        size_t size = 8 + ((seed >> 8) & 0xFF);
+        uint32_t start = mbed_profile_now();
+        if (slots[slot] == NULL) {
+            slots[slot] = alloc(size);
+            timing_add(&alloc_time, mbed_profile_now() - start);
+            if (slots[slot] == NULL) {
+                failed++;
+            }
+        } else {
+            release(slots[slot]);
+            timing_add(&free_time, mbed_profile_now() - start);
+            slots[slot] = NULL;
+        }
+    }
+    for (int i = 0; i < SLOTS; i++) {
+        release(slots[i]);
+        slots[i] = NULL;
+    }
+
+    printf("%s: %u failed\r\n", name, (unsigned)failed);
+    timing_print("alloc", &alloc_time);
+    timing_print("free", &free_time);
+}
+
+int main() {
+    mbed_profile_init();
+    printf("         min    avg    max\r\n");
+
+    run("libc", malloc, free);
+    run("tlsf", mbed_alloc_malloc, mbed_alloc_free);
+
+    mbed_alloc_stats_t stats;
+    mbed_alloc_get_stats(&stats);
+    printf("heap %u, free %u, largest free %u, high-water %u\r\n",
+           (unsigned)stats.heap_size, (unsigned)stats.free_size,
+           (unsigned)stats.largest_free_size, (unsigned)stats.max_allocated_size);
+
+    while (1);
+}
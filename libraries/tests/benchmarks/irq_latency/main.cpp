@@ -0,0 +1,73 @@
+/* Interrupt entry latency through InterruptManager
+ *
+ * A spare interrupt is set pending from main and the cycle counter is
+ * read again in the last handler of the chain. Printed are the minimum,
+ * average and maximum number of cycles for a handler in the vector table,
+ * a chain that collapsed back to a single handler, and chains of two and
+ * four handlers.
+ */
+#include "mbed.h"
+#include "InterruptManager.h"
+
+#if defined(TARGET_K64F)
+#define TEST_IRQ    SWI_IRQn
+#elif defined(TARGET_LPC176X)
+#define TEST_IRQ    I2S_IRQn
+#else
+#error This benchmark needs a spare interrupt for this target
+#endif
+
+#define ITERATIONS  1000
+
+static volatile uint32_t start, end;
+
+static void empty(void) {
+}
+
+static void stamp(void) {
+    end = DWT->CYCCNT;
+}
+
+static void measure(const char *name) {
+    uint32_t min = 0xFFFFFFFF, max = 0, total = 0;
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        start = DWT->CYCCNT;
+        NVIC_SetPendingIRQ(TEST_IRQ);
+        __DSB();
+        __ISB();
+        uint32_t cycles = end - start;
+        if (cycles < min) min = cycles;
+        if (cycles > max) max = cycles;
+        total += cycles;
+    }
+    printf("%-24s min %4u avg %4u max %4u cycles\r\n", name,
+           (unsigned)min, (unsigned)(total / ITERATIONS), (unsigned)max);
+}
+
+int main() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    InterruptManager *manager = InterruptManager::get();
+    NVIC_EnableIRQ(TEST_IRQ);
+
+    NVIC_SetVector(TEST_IRQ, (uint32_t)stamp);
+    measure("vector table");
+
+    // adding and removing a handler leaves stamp installed directly again
+    pFunctionPointer_t pf = manager->add_handler(empty, TEST_IRQ);
+    manager->remove_handler(pf, TEST_IRQ);
+    measure("collapsed chain");
+
+    manager->add_handler_front(empty, TEST_IRQ);
+    measure("chain of 2");
+
+    manager->add_handler_front(empty, TEST_IRQ);
+    manager->add_handler_front(empty, TEST_IRQ);
+    measure("chain of 4");
+
+    NVIC_DisableIRQ(TEST_IRQ);
+    while (1);
+}
@@ -0,0 +1,6 @@
+#include "mbed.h"
+#include "mbed_printf.h"
+
+int main() {
+    mbed_printf("Hello World!");
+}
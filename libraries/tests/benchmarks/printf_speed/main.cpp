@@ -0,0 +1,66 @@
+/* Compact printf against the C library
+ *
+ * Each format is printed into a buffer with snprintf() and with
+ * mbed_snprintf(). Printed are the cycles taken and the stack used by
+ * each, the stack being measured by painting the area below the current
+ * stack pointer and looking for the deepest word that was overwritten.
+ */
+#include "mbed.h"
+#include "mbed_printf.h"
+#include "mbed_profile.h"
+
+#define STACK_PAINT     2048
+#define PAINT           0xDEADBEEF
+#define ITERATIONS      100
+
+static char buffer[64];
+
+static void __attribute__((noinline)) paint_stack(void) {
+    volatile uint32_t area[STACK_PAINT / 4];
+    for (int i = 0; i < STACK_PAINT / 4; i++) {
+        area[i] = PAINT;
+    }
+}
+
+static uint32_t __attribute__((noinline)) used_stack(void) {
+    volatile uint32_t area[STACK_PAINT / 4];
+    int i = 0;
+    while ((i < STACK_PAINT / 4) && (area[i] == PAINT)) {
+        i++;
+    }
+    return (STACK_PAINT / 4 - i) * 4;
+}
+
+#define MEASURE(name, call) do {                                    \
+    uint32_t best = 0xFFFFFFFF;                                     \
+    for (int i = 0; i < ITERATIONS; i++) {                          \
+        uint32_t start = mbed_profile_now();                        \
+        call;                                                       \
+        uint32_t time = mbed_profile_now() - start;                 \
+        if (time < best) best = time;                               \
+    }                                                               \
+    paint_stack();                                                  \
+    call;                                                           \
+    printf("  %-6s %6u " MBED_PROFILE_UNIT " %5u bytes stack\r\n",  \
+           name, (unsigned)best, (unsigned)used_stack());           \
+} while (0)
+
+#define COMPARE(...) do {                                           \
+    printf("%s\r\n", #__VA_ARGS__);                                 \
+    MEASURE("libc", snprintf(buffer, sizeof(buffer), __VA_ARGS__)); \
+    MEASURE("mbed", mbed_snprintf(buffer, sizeof(buffer), __VA_ARGS__)); \
+} while (0)
+
+int main() {
+    mbed_profile_init();
+
+    COMPARE("Hello World!");
+    COMPARE("%d", 12345);
+    COMPARE("%08x %-6s|", 0xBEEFu, "abc");
+    COMPARE("%lld", -1234567890123LL);
+    COMPARE("%f", 3.14159265);
+    COMPARE("%.3e", 0.000123);
+    COMPARE("%g", 1234.5);
+
+    while (1);
+}
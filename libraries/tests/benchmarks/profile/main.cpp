@@ -0,0 +1,77 @@
+/* Profiling statistics and histograms
+ *
+ * Times a few code sequences of known relative length with the profiling
+ * macros, checks that the statistics are consistent and prints the table.
+ * The same code runs on the host, timed with clock_gettime():
+ *   gcc -O2 -I ../ticker_queue/host -I ../../../mbed/api -c ../../../mbed/common/mbed_profile.c ../../../mbed/common/critical.c
+ *   g++ -O2 -I ../ticker_queue/host -I ../../../mbed/api main.cpp mbed_profile.o critical.o -o profile
+ *   ./profile
+ */
+#define MBED_PROFILE
+#include <stdio.h>
+#include "mbed_profile.h"
+
+#define ITERATIONS  1000
+
+static volatile int sink;
+
+static void spin(int n) {
+    for (int i = 0; i < n; i++) {
+        sink += i;
+    }
+}
+
+static void short_loop() {
+    MBED_PROFILE_SCOPE(short_loop);
+    spin(100);
+}
+
+static void long_loop() {
+    MBED_PROFILE_SCOPE(long_loop);
+    spin(10000);
+}
+
+static bool check(int site) {
+    const mbed_profile_site_t *s = mbed_profile_get(site);
+    uint32_t in_buckets = 0;
+    for (int b = 0; b < MBED_PROFILE_BUCKETS; b++) {
+        in_buckets += s->histogram[b];
+    }
+    return s->count == ITERATIONS && in_buckets == ITERATIONS &&
+           s->min <= s->total / s->count && s->total / s->count <= s->max;
+}
+
+int main() {
+    bool result = true;
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        MBED_PROFILE_START(empty);
+        MBED_PROFILE_STOP(empty);
+        short_loop();
+        long_loop();
+    }
+
+    if (mbed_profile_count() != 3 || mbed_profile_get(3) != NULL) {
+        result = false;
+    }
+    for (int i = 0; i < mbed_profile_count(); i++) {
+        result = result && check(i);
+    }
+
+    // 100 times the work has to take longer on average
+    const mbed_profile_site_t *s = mbed_profile_get(1);
+    const mbed_profile_site_t *l = mbed_profile_get(2);
+    if (l->total / l->count <= s->total / s->count) {
+        result = false;
+    }
+
+    mbed_profile_dump();
+
+    mbed_profile_reset();
+    if (mbed_profile_count() != 3 || mbed_profile_get(0)->count != 0) {
+        result = false;
+    }
+
+    printf("%s\r\n", result ? "OK" : "FAILED");
+    return result ? 0 : 1;
+}
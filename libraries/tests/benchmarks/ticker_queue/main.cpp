@@ -0,0 +1,94 @@
+/* Host benchmark for the us_ticker event queue
+ *
+ * Inserts EVENT_COUNT events with pseudo random timestamps, cancels them in
+ * a different order, then fills the queue again and drains it through
+ * us_ticker_irq_handler() checking that the events fire in order.
+ *
+ * Build and run on the host against the queue implementation in the tree:
+ *   gcc -O2 -I host -I ../../../mbed/hal -I ../../../mbed/api -c ../../../mbed/common/ticker_api.c ../../../mbed/common/us_ticker_api.c ../../../mbed/common/critical.c
+ *   g++ -O2 -I host -I ../../../mbed/hal main.cpp ticker_api.o us_ticker_api.o critical.o -o ticker_queue
+ *   ./ticker_queue
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "us_ticker_api.h"
+
+#define EVENT_COUNT 10000
+
+static ticker_event_t events[EVENT_COUNT];
+static uint32_t order[EVENT_COUNT];
+
+// Fake ticker: the benchmark moves the time forward itself
+static uint32_t now;
+static uint32_t last_fired;
+static uint32_t fired;
+static bool in_order = true;
+
+extern "C" {
+void us_ticker_init(void) {}
+uint32_t us_ticker_read(void) { return now; }
+void us_ticker_set_interrupt(unsigned int timestamp) {}
+void us_ticker_disable_interrupt(void) {}
+void us_ticker_clear_interrupt(void) {}
+}
+
+static void handler(uint32_t id) {
+    ticker_event_t *e = &events[id];
+    if (fired > 0 && (int)(e->timestamp - last_fired) < 0) {
+        in_order = false;
+    }
+    last_fired = e->timestamp;
+    fired++;
+}
+
+static double elapsed_ns(const struct timespec &start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+static void insert_all(void) {
+    for (int i = 0; i < EVENT_COUNT; i++) {
+        us_ticker_insert_event(&events[i], now + 1 + (rand() % 1000000), i);
+    }
+}
+
+int main() {
+    struct timespec start;
+    srand(1);
+    us_ticker_set_handler(handler);
+
+    for (int i = 0; i < EVENT_COUNT; i++) {
+        order[i] = i;
+    }
+    for (int i = EVENT_COUNT - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        uint32_t t = order[i]; order[i] = order[j]; order[j] = t;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    insert_all();
+    double insert_ns = elapsed_ns(start);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < EVENT_COUNT; i++) {
+        us_ticker_remove_event(&events[order[i]]);
+    }
+    double remove_ns = elapsed_ns(start);
+
+    insert_all();
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    now += 1000001;
+    us_ticker_irq_handler();
+    double drain_ns = elapsed_ns(start);
+
+    printf("%d events\n", EVENT_COUNT);
+    printf("insert: %8.1f ns/event\n", insert_ns / EVENT_COUNT);
+    printf("cancel: %8.1f ns/event\n", remove_ns / EVENT_COUNT);
+    printf("fire  : %8.1f ns/event\n", drain_ns / EVENT_COUNT);
+
+    bool ok = in_order && (fired == EVENT_COUNT);
+    printf("{{%s}}\n", ok ? "success" : "failure");
+    return ok ? 0 : 1;
+}
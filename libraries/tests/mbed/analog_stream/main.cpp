@@ -0,0 +1,75 @@
+/* Timer triggered AnalogIn streaming
+ *
+ * Samples an input at 50 kHz for one second and checks that the half
+ * buffer callbacks arrive at the expected rate, alternate between the two
+ * halves and that no conversions were lost. The input can be left open.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#if defined(TARGET_K64F)
+#define AIN     A0
+#else
+#define AIN     p20
+#endif
+
+#define RATE    50000
+#define LENGTH  500
+
+uint16_t samples[LENGTH];
+float fsamples[LENGTH];
+
+volatile int blocks;
+volatile int errors;
+void *volatile last;
+
+void block(void *data, int count) {
+    if (count != LENGTH / 2 || data == last)
+        errors++;
+    last = data;
+    blocks++;
+}
+
+void fblock(void *data, int count) {
+    float *s = (float*)data;
+    for (int i = 0; i < count; i++) {
+        if (s[i] < 0.0f || s[i] > 1.0f)
+            errors++;
+    }
+    blocks++;
+}
+
+int main() {
+    bool result = true;
+    AnalogInStream ain(AIN);
+
+    if (ain.start(RATE, samples, LENGTH - 1, block) != -1) {
+        printf("Odd buffer length accepted\r\n");
+        result = false;
+    }
+
+    ain.start(RATE, samples, LENGTH, block);
+    wait(1.0);
+    ain.stop();
+    int expected = 2 * RATE / LENGTH;
+    printf("%d blocks in 1s (expected %d), %d errors, %u overruns\r\n",
+           blocks, expected, errors, (unsigned)ain.overruns());
+    if (blocks < expected - 2 || blocks > expected + 2 || errors || ain.overruns() || ain.running())
+        result = false;
+
+    blocks = errors = 0;
+    ain.start(RATE, fsamples, LENGTH, fblock, AnalogInFormatF32);
+    wait(0.1);
+    ain.stop();
+    printf("float: %d blocks, %d out of range\r\n", blocks, errors);
+    if (blocks == 0 || errors)
+        result = false;
+
+    // the input is usable again once stopped
+    AnalogIn single(AIN);
+    float value = single.read();
+    if (value < 0.0f || value > 1.0f)
+        result = false;
+
+    notify_completion(result);
+}
@@ -0,0 +1,105 @@
+/* Nested critical sections and interrupt masking budget
+ *
+ * Checks that only the outermost critical section enables interrupts
+ * again, and never when they were disabled before it was entered.
+ *
+ * With the library built with MBED_CRITICAL_TRACE, a Ticker and Timeouts
+ * scheduled from main are run for a second and the test fails if any
+ * critical section kept interrupts masked longer than CRITICAL_BUDGET
+ * (in MBED_PROFILE_UNIT), printing the longest ones with their callers.
+ */
+#include "mbed.h"
+#include "critical.h"
+#include "mbed_profile.h"
+#include "test_env.h"
+
+#ifndef CRITICAL_BUDGET
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x03)
+#define CRITICAL_BUDGET     1000    // cycles
+#else
+#define CRITICAL_BUDGET     20      // us
+#endif
+#endif
+
+static volatile int ticks;
+
+static void tick() {
+    ticks++;
+}
+
+static bool check_nesting() {
+    bool result = true;
+
+    core_util_critical_section_enter();
+    core_util_critical_section_enter();
+    core_util_critical_section_exit();
+    result = result && !core_util_are_interrupts_enabled();
+    core_util_critical_section_exit();
+    result = result && core_util_are_interrupts_enabled();
+
+    __disable_irq();
+    core_util_critical_section_enter();
+    core_util_critical_section_exit();
+    result = result && !core_util_are_interrupts_enabled();
+    __enable_irq();
+
+    return result;
+}
+
+#ifdef MBED_CRITICAL_TRACE
+static void long_section() {
+    core_util_critical_section_enter();
+    wait_us(100);
+    core_util_critical_section_exit();
+}
+
+static bool check_budget() {
+    bool result = true;
+    void *caller;
+
+    // a section known to be too long is caught
+    core_util_critical_trace_reset();
+    long_section();
+    if (core_util_critical_trace_max(&caller) < CRITICAL_BUDGET || caller == NULL) {
+        printf("Long section not traced\r\n");
+        result = false;
+    }
+
+    core_util_critical_trace_reset();
+    Ticker ticker;
+    ticker.attach_us(tick, 1000);
+    Timeout timeouts[4];
+    Timer timer;
+    timer.start();
+    while (timer.read_ms() < 1000) {
+        for (int i = 0; i < 4; i++) {
+            timeouts[i].attach_us(tick, 100 + i * 37);
+        }
+    }
+    ticker.detach();
+
+    uint32_t max = core_util_critical_trace_max(&caller);
+    printf("Longest masked interval %lu %s at %p (budget %d)\r\n",
+           (unsigned long)max, MBED_PROFILE_UNIT, caller, CRITICAL_BUDGET);
+
+    core_util_critical_trace_t trace[MBED_CRITICAL_TRACE_SIZE];
+    int count = core_util_critical_trace_read(trace, MBED_CRITICAL_TRACE_SIZE);
+    for (int i = 0; i < count; i++) {
+        printf("  %8lu at %p\r\n", (unsigned long)trace[i].duration, trace[i].caller);
+    }
+    return result && max <= CRITICAL_BUDGET;
+}
+#endif
+
+int main() {
+    bool result = check_nesting();
+    printf("Nesting %s\r\n", result ? "OK" : "FAILED");
+
+#ifdef MBED_CRITICAL_TRACE
+    result = check_budget() && result;
+#else
+    printf("Built without MBED_CRITICAL_TRACE, budget not checked\r\n");
+#endif
+
+    notify_completion(result);
+}
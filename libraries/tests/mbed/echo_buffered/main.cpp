@@ -0,0 +1,30 @@
+#include "mbed.h"
+
+#if defined(TARGET_NUCLEO_F103RB) || \
+    defined(TARGET_NUCLEO_L152RE) || \
+    defined(TARGET_NUCLEO_F302R8) || \
+    defined(TARGET_NUCLEO_F030R8) || \
+    defined(TARGET_NUCLEO_F401RE) || \
+    defined(TARGET_NUCLEO_F411RE) || \
+    defined(TARGET_NUCLEO_F072RB) || \
+    defined(TARGET_NUCLEO_F334R8) || \
+    defined(TARGET_NUCLEO_L053R8)
+#define TXPIN     STDIO_UART_TX
+#define RXPIN     STDIO_UART_RX
+#else
+#define TXPIN     USBTX
+#define RXPIN     USBRX
+#endif
+
+// Echo through the bulk read/write path of BufferedSerial
+int main() {
+    char buf[64];
+
+    BufferedSerial pc(TXPIN, RXPIN, 512, 512);
+    pc.baud(115200);
+
+    while (1) {
+        int n = pc.read(buf, sizeof(buf));
+        pc.write(buf, n);
+    }
+}
@@ -0,0 +1,93 @@
+#include "test_env.h"
+
+#define TICKER_POSTS   50
+#define PERIODIC_POSTS 20
+
+EventQueue queue;
+Ticker ticker;
+
+volatile int ticker_calls = 0;
+volatile int periodic_calls = 0;
+volatile int delayed_calls = 0;
+volatile int dropped_calls = 0;
+volatile int done_calls = 0;
+volatile int kept_calls = 0;
+bool in_isr = false;
+
+void on_ticker() {
+    ticker_calls++;
+    // deferred calls must not run in interrupt context
+    if (__get_IPSR() != 0) {
+        in_isr = true;
+    }
+}
+
+void on_periodic() {
+    periodic_calls++;
+}
+
+void on_delayed() {
+    delayed_calls++;
+}
+
+void on_dropped() {
+    dropped_calls++;
+}
+
+void on_done() {
+    done_calls++;
+}
+
+void on_kept() {
+    kept_calls++;
+}
+
+Event ticker_event(&queue, &on_ticker);
+Event periodic_event(&queue, &on_periodic);
+Event delayed_event(&queue, &on_delayed);
+
+int main() {
+    ticker.attach_us(&ticker_event, 10000);
+    periodic_event.post_every(25000);
+    delayed_event.post_in(100000);
+
+    Timer timer;
+    timer.start();
+    while ((ticker_calls < TICKER_POSTS) || (periodic_calls < PERIODIC_POSTS)) {
+        queue.dispatch_pending();
+        if (timer.read() > 5.0f) {
+            break;
+        }
+    }
+    ticker.detach();
+    periodic_event.cancel();
+
+    // Pending events destroyed or cancelled before the dispatch are removed
+    // from the queue, their done function runs in place of the dispatch
+    Event *destroyed = new Event(&queue, &on_dropped);
+    Event *cancelled = new Event(&queue, &on_dropped);
+    Event kept(&queue, &on_kept);
+    destroyed->attach_done(&on_done);
+    cancelled->attach_done(&on_done);
+    cancelled->post();
+    destroyed->post();
+    kept.post();
+    delete destroyed;
+    cancelled->cancel();
+    delete cancelled;
+    queue.dispatch_pending();
+    printf("dropped : %d calls, %d done, kept %d calls" NL, dropped_calls, done_calls, kept_calls);
+
+    printf("ticker  : %d calls, latency min %u max %u mean %u us, missed %u" NL,
+           ticker_calls, ticker_event.latency_min(), ticker_event.latency_max(),
+           ticker_event.latency_mean(), ticker_event.missed_count());
+    printf("periodic: %d calls, latency max %u us" NL, periodic_calls, periodic_event.latency_max());
+    printf("delayed : %d calls" NL, delayed_calls);
+    printf("queue   : latency max %u us" NL, queue.latency_max());
+
+    bool result = (ticker_calls >= TICKER_POSTS) && (periodic_calls >= PERIODIC_POSTS) &&
+                  (delayed_calls == 1) && !in_isr &&
+                  (dropped_calls == 0) && (done_calls == 2) && (kept_calls == 1) &&
+                  (ticker_event.dispatch_count() == (uint32_t)ticker_calls);
+    notify_completion(result);
+}
@@ -1,4 +1,7 @@
 #include "test_env.h"
+#ifdef MBED_HEAP_TLSF
+#include "mbed_alloc.h"
+#endif
 
 static char *initial_stack_p;
 static char *initial_heap_p;
@@ -18,6 +21,13 @@ void report_iterations(void) {
     __heapvalid((__heapprt) fprintf, stdout, 1);
 #endif
 #endif
+#ifdef MBED_HEAP_TLSF
+    mbed_alloc_stats_t stats;
+    mbed_alloc_get_stats(&stats);
+    printf("heap %u, free %u, largest free %u, high-water %u, failed %u\n",
+           (unsigned)stats.heap_size, (unsigned)stats.free_size, (unsigned)stats.largest_free_size,
+           (unsigned)stats.max_allocated_size, (unsigned)stats.alloc_fail_count);
+#endif
 }
 
 void stack_test(char *latest_heap_pointer) {
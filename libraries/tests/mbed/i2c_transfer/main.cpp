@@ -0,0 +1,98 @@
+/* Queued I2C transactions
+ *
+ * Two I2C objects at different frequencies share the bus of a TMP102 and
+ * queue temperature register reads while main keeps running. The reads must
+ * complete in order, agree with a blocking read, and a transaction to an
+ * absent slave must report I2C_EVENT_ERROR_NO_SLAVE.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#define TMP102_ADDRESS  0x90
+#define ABSENT_ADDRESS  0x5E
+#define READS           6
+
+I2C fast(p28, p27);
+I2C slow(p28, p27);
+
+I2C::Transaction reads[READS];
+I2C::Transaction probe;
+char pointer = 0x00;
+char data[READS][2];
+
+volatile int order[READS + 1];
+volatile int completed;
+
+class Result {
+public:
+    Result(int index) : _index(index) {}
+    void done(int event) {
+        order[_index] = (event == I2C_EVENT_COMPLETE) ? ++completed : -event;
+    }
+    int _index;
+};
+
+Result *results[READS];
+volatile int probe_event;
+
+void probe_done(int event) {
+    probe_event = event;
+    ++completed;
+}
+
+int main() {
+    bool result = true;
+
+    fast.frequency(400000);
+    slow.frequency(100000);
+
+    for (int i = 0; i < READS; i++) {
+        results[i] = new Result(i);
+        reads[i].address = TMP102_ADDRESS;
+        reads[i].tx_buffer = &pointer;
+        reads[i].tx_length = 1;
+        reads[i].rx_buffer = data[i];
+        reads[i].rx_length = 2;
+        reads[i].callback.attach(results[i], &Result::done);
+        (i & 1 ? slow : fast).transfer(&reads[i]);
+    }
+    probe.address = ABSENT_ADDRESS;
+    probe.callback.attach(probe_done);
+    fast.transfer(&probe);
+
+    if (reads[READS - 1].pending() && slow.transfer(&reads[READS - 1]) != -1) {
+        printf("A pending transaction was queued twice\r\n");
+        result = false;
+    }
+
+    int spins = 0;
+    Timer timeout;
+    timeout.start();
+    while (completed < READS + 1 && timeout.read_ms() < 1000) {
+        spins++;
+    }
+    printf("Main loop ran %d times during the transactions\r\n", spins);
+
+    for (int i = 0; i < READS; i++) {
+        if (order[i] != i + 1) {
+            printf("Read %d ended as %d\r\n", i, order[i]);
+            result = false;
+        }
+    }
+    if (probe_event != I2C_EVENT_ERROR_NO_SLAVE) {
+        printf("Absent slave reported %d\r\n", probe_event);
+        result = false;
+    }
+
+    char blocking[2];
+    fast.write(TMP102_ADDRESS, &pointer, 1, true);
+    fast.read(TMP102_ADDRESS, blocking, 2);
+    float t = ((blocking[0] << 4) | (blocking[1] >> 4)) * 0.0625f;
+    float q = ((data[READS - 1][0] << 4) | (data[READS - 1][1] >> 4)) * 0.0625f;
+    printf("Temperature %.2f (queued) %.2f (blocking)\r\n", q, t);
+    if (q - t > 1.0f || t - q > 1.0f) {
+        result = false;
+    }
+
+    notify_completion(result);
+}
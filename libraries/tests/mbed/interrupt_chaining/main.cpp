@@ -5,12 +5,16 @@
 
 #if defined(TARGET_LPC1768) || defined(TARGET_LPC4088)
 #define TIMER_IRQ       TIMER3_IRQn
+#define OTHER_IRQ       TIMER2_IRQn
 #elif defined(TARGET_LPC11U24) || defined(TARGET_LPC1114)
 #define TIMER_IRQ       TIMER_32_1_IRQn
+#define OTHER_IRQ       TIMER_32_0_IRQn
 #elif defined(TARGET_KL25Z)
 #define TIMER_IRQ       LPTimer_IRQn
+#define OTHER_IRQ       PIT_IRQn
 #elif defined(TARGET_LPC2368)
 #define TIMER_IRQ       TIMER3_IRQn
+#define OTHER_IRQ       TIMER2_IRQn
 #else
 #error This test can't run on this target.
 #endif
@@ -107,5 +111,29 @@ int main() {
         notify_completion(false);
     }
 
+    // Chains holding member functions only are released too: more of them
+    // than the pool has, in turn, and the vector is back each time
+    uint32_t other_handler = NVIC_GetVector(OTHER_IRQ);
+    for (int i = 0; i <= INTERRUPT_MANAGER_CHAINS; i++) {
+        pFunctionPointer_t p1 = pManager->add_handler(&c, &Counter::inc, OTHER_IRQ);
+        pFunctionPointer_t p2 = pManager->add_handler_front(&c, &Counter::inc, OTHER_IRQ);
+        if ((p1 == NULL) || (p2 == NULL) ||
+            !pManager->remove_handler(p1, OTHER_IRQ) || !pManager->remove_handler(p2, OTHER_IRQ) ||
+            (NVIC_GetVector(OTHER_IRQ) != other_handler)) {
+            printf("Chain %d not released.\n", i);
+            notify_completion(false);
+        }
+    }
+    // and the two interrupts never share a handler list
+    pFunctionPointer_t p1 = pManager->add_handler(&c, &Counter::inc, OTHER_IRQ);
+    pFunctionPointer_t p2 = pManager->add_handler(testme, TIMER_IRQ);
+    if ((p1 == p2) || pManager->remove_handler(p1, TIMER_IRQ) || pManager->remove_handler(p2, OTHER_IRQ) ||
+        !pManager->remove_handler(p1, OTHER_IRQ) || !pManager->remove_handler(p2, TIMER_IRQ) ||
+        (NVIC_GetVector(OTHER_IRQ) != other_handler) || (NVIC_GetVector(TIMER_IRQ) != initial_handler)) {
+        printf("Chains shared between interrupts.\n");
+        notify_completion(false);
+    }
+    printf("Chains released.\n");
+
     while(1);
 }
@@ -0,0 +1,49 @@
+/* Low power ticker
+ *
+ * A LowPowerTimeout must wake the core up from deepsleep(), where the
+ * us_ticker stops, and a LowPowerTicker must keep ticking meanwhile. The
+ * lp_ticker may be coarse (1s alarms on the KL25Z RTC), so the checks only
+ * bound the wake up time to one extra second.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#define TIMEOUT_S       2
+#define TICKER_S        1
+
+static LowPowerTimeout timeout;
+static LowPowerTicker ticker;
+static LowPowerTimer timer;
+static volatile bool expired;
+static volatile int ticks;
+
+static void expire() {
+    expired = true;
+}
+
+static void tick() {
+    ticks++;
+}
+
+int main() {
+    bool result = true;
+
+    timer.start();
+    ticker.attach(&tick, TICKER_S);
+    timeout.attach(&expire, TIMEOUT_S);
+
+    while (!expired) {
+        deepsleep();
+    }
+    int elapsed_ms = timer.read_ms();
+    ticker.detach();
+
+    printf("woke up after %d ms, %d ticks\r\n", elapsed_ms, ticks);
+    if ((elapsed_ms < TIMEOUT_S * 1000) || (elapsed_ms > (TIMEOUT_S + 1) * 1000 + 100)) {
+        result = false;
+    }
+    if (ticks < TIMEOUT_S / TICKER_S - 1) {
+        result = false;
+    }
+    notify_completion(result);
+}
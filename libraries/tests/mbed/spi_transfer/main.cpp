@@ -0,0 +1,94 @@
+/* Asynchronous SPI transfers
+ *
+ * Needs a wire between MOSI and MISO. Two SPI objects share the bus, their
+ * transfers are queued and must complete in order with the sent data
+ * looped back, while main keeps running.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#if defined(TARGET_K64F)
+#define SPI_PINS    PTD2, PTD3, PTD1
+#define SSEL_A      PTD0
+#define SSEL_B      PTC4
+#elif defined(TARGET_STM32F4XX)
+#define SPI_PINS    PA_7, PA_6, PA_5
+#define SSEL_A      PA_4
+#define SSEL_B      PB_6
+#else
+#define SPI_PINS    p5, p6, p7
+#define SSEL_A      p8
+#define SSEL_B      p14
+#endif
+
+#define LENGTH  64
+
+SPI spi_a(SPI_PINS, SSEL_A);
+SPI spi_b(SPI_PINS, SSEL_B);
+
+uint8_t tx_a[LENGTH], rx_a[LENGTH];
+uint16_t tx_b[LENGTH], rx_b[LENGTH];
+
+volatile int done[2];
+volatile int order;
+
+void done_a(int event) {
+    done[0] = (event == SPI_EVENT_COMPLETE) ? ++order : -1;
+}
+
+void done_b(int event) {
+    done[1] = (event == SPI_EVENT_COMPLETE) ? ++order : -1;
+}
+
+int main() {
+    bool result = true;
+
+    spi_a.format(8, 0);
+    spi_a.frequency(1000000);
+    spi_b.format(16, 3);
+    spi_b.frequency(500000);
+    for (int i = 0; i < LENGTH; i++) {
+        tx_a[i] = i;
+        tx_b[i] = 0x8000 | (i << 4);
+    }
+
+    SPI::event_callback_t cb_a(done_a);
+    SPI::event_callback_t cb_b(done_b);
+    if (spi_a.transfer(tx_a, rx_a, LENGTH, cb_a) != 0 ||
+        spi_b.transfer(tx_b, rx_b, LENGTH, cb_b) != 0) {
+        printf("Failed to start the transfers\r\n");
+        notify_completion(false);
+    }
+    if (spi_a.transfer(tx_a, rx_a, LENGTH, cb_a) != -1) {
+        printf("Second transfer of the same object accepted\r\n");
+        result = false;
+    }
+
+    int spins = 0;
+    Timer timeout;
+    timeout.start();
+    while ((done[0] == 0 || done[1] == 0) && timeout.read_ms() < 1000) {
+        spins++;
+    }
+    printf("Main loop ran %d times during the transfers\r\n", spins);
+
+    if (done[0] != 1 || done[1] != 2) {
+        printf("Transfers completed out of order: %d %d\r\n", done[0], done[1]);
+        result = false;
+    }
+    for (int i = 0; i < LENGTH; i++) {
+        if (rx_a[i] != tx_a[i] || rx_b[i] != tx_b[i]) {
+            printf("Mismatch at %d: %02X/%02X %04X/%04X\r\n", i, tx_a[i], rx_a[i], tx_b[i], rx_b[i]);
+            result = false;
+            break;
+        }
+    }
+
+    // blocking writes still work once the bus is idle
+    if (spi_a.write(0x5A) != 0x5A) {
+        printf("Blocking write failed\r\n");
+        result = false;
+    }
+
+    notify_completion(result);
+}
@@ -0,0 +1,54 @@
+/* Ticker overrun policies and jitter statistics
+ *
+ * A 1 ms Ticker whose fifth call takes 3.5 ms is run for 20 ms with each
+ * overrun policy. Two periods are missed every time; CatchUp makes up the
+ * missed calls, Skip and Coalesce drop them. The jitter statistics must
+ * have measured every call and seen the 2.5 ms late one.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#define PERIOD_US       1000
+#define OVERRUN_US      3500
+#define RUN_MS          20
+
+static Ticker ticker;
+static TickerStats stats;
+static volatile int calls;
+
+static void tick() {
+    calls++;
+    if (calls == 5) {
+        wait_us(OVERRUN_US);
+    }
+}
+
+static int run(Ticker::OverrunPolicy policy, const char *name, bool *result) {
+    calls = 0;
+    ticker.set_overrun_policy(policy);
+    ticker.attach_stats(&stats);
+    ticker.attach_us(&tick, PERIOD_US);
+    wait_ms(RUN_MS);
+    ticker.detach();
+
+    printf("%-8s calls %2d, missed %u, jitter %u..%u us\r\n", name, calls,
+           (unsigned)ticker.missed_periods(), (unsigned)stats.min, (unsigned)stats.max);
+    if ((ticker.missed_periods() < 2) || (stats.count != (uint32_t)calls)
+            || (stats.max < OVERRUN_US - 2 * PERIOD_US)) {
+        *result = false;
+    }
+    return calls;
+}
+
+int main() {
+    bool result = true;
+
+    int catch_up = run(Ticker::CatchUp, "catch-up", &result);
+    int skip = run(Ticker::Skip, "skip", &result);
+    int coalesce = run(Ticker::Coalesce, "coalesce", &result);
+
+    if ((catch_up < skip + 2) || (catch_up < coalesce + 2)) {
+        result = false;
+    }
+    notify_completion(result);
+}
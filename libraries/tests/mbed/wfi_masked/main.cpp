@@ -0,0 +1,42 @@
+/* Sleep with interrupts masked
+ *
+ * __WFI() called with interrupts masked must return once an interrupt is
+ * pending, and the handler must only run when interrupts are unmasked
+ * again. This is how EventQueue::dispatch() and the idle loop sleep
+ * without missing an interrupt raised just before.
+ */
+#include "mbed.h"
+#include "test_env.h"
+
+#define ROUNDS      20
+#define DELAY_US    5000
+
+static Timeout timeout;
+static volatile int calls;
+
+static void expire() {
+    calls++;
+}
+
+int main() {
+    bool result = true;
+    Timer timer;
+    timer.start();
+
+    for (int i = 0; i < ROUNDS && result; i++) {
+        timeout.attach_us(&expire, DELAY_US);
+        __disable_irq();
+        // returns once the interrupt is pending, hangs if it was lost
+        __WFI();
+        if (calls != i) {
+            // the handler ran while interrupts were masked
+            result = false;
+        }
+        __enable_irq();
+        while (calls == i) {
+        }
+    }
+
+    printf("%d rounds in %d ms\r\n", calls, timer.read_ms());
+    notify_completion(result && (calls == ROUNDS));
+}
@@ -0,0 +1,97 @@
+/* Context switch latency
+ *
+ * "switch": two threads of the same priority pass a signal back and forth,
+ * each pass makes the other thread ready and blocks the current one.
+ * "wake": a high priority thread signals WORKERS lower priority threads in
+ * turn; with the sorted ready list each wake up walks past the workers
+ * already made ready, with OS_RDYBITMAP it takes constant time.
+ */
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define ITERATIONS      2000
+#define ROUNDS          200
+#define WORKERS         8
+#define STACK_SIZE      512
+#define SIGNAL_PASS     0x01
+#define SIGNAL_DONE     0x02
+
+static Thread *ping_thread;
+static Thread *pong_thread;
+static osThreadId main_id;
+static Timer timer;
+
+static void ping(void const *argument) {
+    Thread::signal_wait(SIGNAL_PASS);
+    timer.start();
+    for (int i = 0; i < ITERATIONS; i++) {
+        pong_thread->signal_set(SIGNAL_PASS);
+        Thread::signal_wait(SIGNAL_PASS);
+    }
+    timer.stop();
+    osSignalSet(main_id, SIGNAL_DONE);
+}
+
+static void pong(void const *argument) {
+    while (true) {
+        Thread::signal_wait(SIGNAL_PASS);
+        ping_thread->signal_set(SIGNAL_PASS);
+    }
+}
+
+static void worker(void const *argument) {
+    while (true) {
+        Thread::signal_wait(SIGNAL_PASS);
+    }
+}
+
+static int measure_switch(void) {
+    Thread pinger(ping, NULL, osPriorityAboveNormal, STACK_SIZE);
+    Thread ponger(pong, NULL, osPriorityAboveNormal, STACK_SIZE);
+    ping_thread = &pinger;
+    pong_thread = &ponger;
+
+    timer.reset();
+    ping_thread->signal_set(SIGNAL_PASS);
+    Thread::signal_wait(SIGNAL_DONE);
+    // Two switches per iteration, in nanoseconds
+    return timer.read_us() * 500 / ITERATIONS;
+}
+
+static int measure_wake(void) {
+    Thread *workers[WORKERS];
+    for (int i = 0; i < WORKERS; i++) {
+        workers[i] = new Thread(worker, NULL, osPriorityBelowNormal, STACK_SIZE);
+    }
+    Thread::wait(1);
+
+    timer.reset();
+    for (int round = 0; round < ROUNDS; round++) {
+        timer.start();
+        for (int i = 0; i < WORKERS; i++) {
+            workers[i]->signal_set(SIGNAL_PASS);
+        }
+        timer.stop();
+        // Let the workers run and block again
+        Thread::wait(1);
+    }
+
+    for (int i = 0; i < WORKERS; i++) {
+        delete workers[i];
+    }
+    // Nanoseconds per wake up
+    return timer.read_us() * 1000 / (ROUNDS * WORKERS);
+}
+
+int main (void) {
+    main_id = osThreadGetId();
+    osThreadSetPriority(main_id, osPriorityHigh);
+
+    int switch_ns = measure_switch();
+    int wake_ns = measure_wake();
+
+    printf("switch %d ns, wake %d ns with %d ready threads\r\n", switch_ns, wake_ns, WORKERS);
+    notify_completion((switch_ns > 0) && (wake_ns > 0));
+    return 0;
+}
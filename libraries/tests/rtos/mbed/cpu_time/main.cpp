@@ -0,0 +1,77 @@
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define STACK_SIZE          512
+#define BUSY_MS             200
+#define SLEEP_MS            20
+#define EVENTS              64
+#define DUMP_SIZE           512
+
+#define STATE_READY         1
+#define STATE_WAIT_DLY      3
+
+volatile uint8_t busy_id;
+volatile uint8_t sleepy_id;
+
+// Spins for BUSY_MS without giving up the processor, then blocks
+void busy_thread(void const *argument) {
+    busy_id = osThreadGetInfo(Thread::gettid(), osThreadInfoTaskId);
+    wait_ms(BUSY_MS);
+    Thread::signal_wait(0x1);
+}
+
+// Sleeps most of the time
+void sleepy_thread(void const *argument) {
+    sleepy_id = osThreadGetInfo(Thread::gettid(), osThreadInfoTaskId);
+    while (true) {
+        Thread::wait(SLEEP_MS);
+    }
+}
+
+static osTraceEvent events[EVENTS];
+static uint32_t dump[DUMP_SIZE / 4];
+
+int main (void) {
+    bool result = true;
+
+    Thread sleepy(sleepy_thread, NULL, osPriorityHigh, STACK_SIZE);
+    Thread busy(busy_thread, NULL, osPriorityNormal, STACK_SIZE);
+    Thread::wait(BUSY_MS + 50);
+
+    uint64_t busy_us = busy.get_cpu_time();
+    uint64_t sleepy_us = sleepy.get_cpu_time();
+    printf("busy %lu us, sleepy %lu us\r\n", (unsigned long)busy_us, (unsigned long)sleepy_us);
+    if ((busy_us < BUSY_MS * 900) || (busy_us > BUSY_MS * 1100)) {
+        result = false;
+    }
+    if ((sleepy_us == 0) || (sleepy_us > BUSY_MS * 50)) {
+        result = false;
+    }
+
+    // The sleepy thread preempts the busy one and goes back to sleep
+    int preempted = 0, slept = 0;
+    int n = osTraceRead(events, EVENTS);
+    for (int i = 0; i < n; i++) {
+        if ((events[i].from == busy_id) && (events[i].to == sleepy_id) && (events[i].state == STATE_READY)) {
+            preempted++;
+        }
+        if ((events[i].from == sleepy_id) && (events[i].state == STATE_WAIT_DLY)) {
+            slept++;
+        }
+    }
+    printf("%d events, %d preemptions, %d sleeps\r\n", n, preempted, slept);
+    if ((preempted < BUSY_MS / SLEEP_MS - 2) || (slept < preempted)) {
+        result = false;
+    }
+
+    uint32_t size = rtos_trace_dump(dump, sizeof(dump));
+    printf("dump %lu bytes\r\n", (unsigned long)size);
+    if ((size <= 16) || (memcmp(dump, "RTXT", 4) != 0)) {
+        result = false;
+    }
+
+    rtos_trace_report();
+    notify_completion(result);
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define CONSUMERS   4
+#define FLAG_GO     0x01
+#define FLAG_A      0x02
+#define FLAG_B      0x04
+#define FLAG_C      0x08
+
+EventFlags flags;
+volatile int woken[CONSUMERS];
+
+void consumer_thread(void const *argument) {
+    const int index = (int)argument;
+    while (true) {
+        uint32_t res = flags.wait_any(FLAG_GO);
+        if ((res & osFlagsError) || !(res & FLAG_GO)) {
+            printf("consumer %d: wait returned 0x%08lx\r\n", index, (unsigned long)res);
+            notify_completion(false);
+        }
+        woken[index]++;
+    }
+}
+
+void isr_set_go(void) {
+    flags.set(FLAG_GO);
+}
+
+void isr_set_b(void) {
+    flags.set(FLAG_B);
+}
+
+static bool all_woken(int count) {
+    for (int i = 0; i < CONSUMERS; i++) {
+        if (woken[i] != count) {
+            printf("consumer %d woken %d times, expected %d\r\n", i, woken[i], count);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main (void) {
+    Thread *threads[CONSUMERS];
+    bool result = true;
+    Timeout timeout;
+
+    for (int i = 0; i < CONSUMERS; i++) {
+        threads[i] = new Thread(consumer_thread, (void *)i, osPriorityAboveNormal);
+    }
+    Thread::wait(10);
+    for (int i = 0; i < CONSUMERS; i++) {
+        if (threads[i]->get_state() != Thread::WaitingEventFlags) {
+            result = false;
+        }
+    }
+
+    // One set from a thread wakes every consumer, then auto-clears
+    flags.set(FLAG_GO);
+    Thread::wait(10);
+    result = result && all_woken(1) && ((flags.get() & FLAG_GO) == 0);
+    printf("thread set: %s\r\n", result ? "OK" : "FAIL");
+
+    // Same from an interrupt handler
+    timeout.attach_us(isr_set_go, 5000);
+    Thread::wait(20);
+    result = result && all_woken(2) && ((flags.get() & FLAG_GO) == 0);
+    printf("isr set: %s\r\n", result ? "OK" : "FAIL");
+
+    // Wait for all: times out with one flag, met once the ISR sets the other
+    flags.set(FLAG_A);
+    if (flags.wait_all(FLAG_A | FLAG_B, 20) != osFlagsErrorTimeout) {
+        result = false;
+    }
+    timeout.attach_us(isr_set_b, 5000);
+    uint32_t res = flags.wait_all(FLAG_A | FLAG_B, 100);
+    if ((res & osFlagsError) || ((res & (FLAG_A | FLAG_B)) != (FLAG_A | FLAG_B)) ||
+        (flags.get() & (FLAG_A | FLAG_B))) {
+        result = false;
+    }
+    printf("wait all: %s\r\n", result ? "OK" : "FAIL");
+
+    // Wait without clearing, polling and explicit clear
+    flags.set(FLAG_C);
+    if (!(flags.wait_any(FLAG_C, 0, false) & FLAG_C) || !(flags.get() & FLAG_C)) {
+        result = false;
+    }
+    if (!(flags.clear(FLAG_C) & FLAG_C) || (flags.get() & FLAG_C)) {
+        result = false;
+    }
+    if (flags.wait_any(FLAG_C, 0) != osFlagsErrorTimeout) {
+        result = false;
+    }
+    printf("no clear: %s\r\n", result ? "OK" : "FAIL");
+
+    for (int i = 0; i < CONSUMERS; i++) {
+        threads[i]->terminate();
+        delete threads[i];
+    }
+    notify_completion(result);
+    return 0;
+}
@@ -0,0 +1,162 @@
+/* Concurrent file access from two threads
+ *
+ * Each thread writes its own file on the SD card, mixing large blocks
+ * written with mbed_fwrite() and short formatted lines, while opening
+ * and closing a scratch file in between. Both files are then read back
+ * and checked. A last file is written with back-to-back mbed_fwrite()
+ * blocks only, the first one after an fopen() in append mode, which both
+ * leave newlib with a cached file offset.
+ */
+#include "mbed.h"
+#include "SDFileSystem.h"
+#include "mbed_retarget.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#if defined(TARGET_K64F)
+SDFileSystem sd(PTD2, PTD3, PTD1, PTD0, "sd");
+#else
+SDFileSystem sd(p11, p12, p13, p14, "sd");
+#endif
+
+#define BLOCK   1024
+#define BLOCKS  8
+
+struct Job {
+    const char *name;
+    const char *scratch;
+    uint8_t seed;
+    volatile bool done;
+    volatile bool ok;
+};
+
+static uint8_t pattern(uint8_t seed, int block, int i) {
+    return (uint8_t)(seed + block * 7 + i);
+}
+
+static void writer(void const *argument) {
+    Job *job = (Job*)argument;
+    static uint8_t buffers[2][BLOCK];
+    uint8_t *buffer = buffers[job->seed & 1];
+    job->ok = true;
+
+    FILE *f = fopen(job->name, "w");
+    if (f == NULL) {
+        job->ok = false;
+        job->done = true;
+        return;
+    }
+    for (int b = 0; b < BLOCKS; b++) {
+        for (int i = 0; i < BLOCK; i++) {
+            buffer[i] = pattern(job->seed, b, i);
+        }
+        if (mbed_fwrite(buffer, 1, BLOCK, f) != BLOCK) {
+            job->ok = false;
+        }
+        fprintf(f, "block %d\n", b);
+
+        // descriptors come and go while the other thread writes
+        FILE *scratch = fopen(job->scratch, "w");
+        if (scratch == NULL || fileno(scratch) == fileno(f)) {
+            job->ok = false;
+        }
+        if (scratch != NULL) {
+            fclose(scratch);
+        }
+    }
+    fclose(f);
+    job->done = true;
+}
+
+static bool check(Job *job) {
+    uint8_t buffer[BLOCK];
+    char line[16], expected[16];
+    bool ok = job->ok;
+
+    FILE *f = fopen(job->name, "r");
+    if (f == NULL) {
+        return false;
+    }
+    for (int b = 0; ok && b < BLOCKS; b++) {
+        if (fread(buffer, 1, BLOCK, f) != BLOCK) {
+            ok = false;
+            break;
+        }
+        for (int i = 0; i < BLOCK; i++) {
+            if (buffer[i] != pattern(job->seed, b, i)) {
+                ok = false;
+                break;
+            }
+        }
+        sprintf(expected, "block %d\n", b);
+        if (fgets(line, sizeof(line), f) == NULL || strcmp(line, expected) != 0) {
+            ok = false;
+        }
+    }
+    fclose(f);
+    printf("%s: %s\r\n", job->name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+static bool check_direct(const char *name) {
+    static uint8_t buffer[BLOCK];
+    bool ok = true;
+
+    FILE *f = fopen(name, "w");
+    if (f == NULL) {
+        return false;
+    }
+    fclose(f);
+    f = fopen(name, "a");
+    if (f == NULL) {
+        return false;
+    }
+    for (int b = 0; b < BLOCKS; b++) {
+        for (int i = 0; i < BLOCK; i++) {
+            buffer[i] = pattern(0x33, b, i);
+        }
+        if (mbed_fwrite(buffer, 1, BLOCK, f) != BLOCK) {
+            ok = false;
+        }
+    }
+    fclose(f);
+
+    f = fopen(name, "r");
+    if (f == NULL) {
+        return false;
+    }
+    for (int b = 0; ok && b < BLOCKS; b++) {
+        if (fread(buffer, 1, BLOCK, f) != BLOCK) {
+            ok = false;
+            break;
+        }
+        for (int i = 0; i < BLOCK; i++) {
+            if (buffer[i] != pattern(0x33, b, i)) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    if (ok && fgetc(f) != EOF) {
+        ok = false;
+    }
+    fclose(f);
+    printf("%s: %s\r\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+int main() {
+    Job a = {"/sd/thread_a.bin", "/sd/scratch_a.txt", 0x10, false, false};
+    Job b = {"/sd/thread_b.bin", "/sd/scratch_b.txt", 0x81, false, false};
+
+    Thread ta(writer, &a, osPriorityNormal, DEFAULT_STACK_SIZE * 2);
+    Thread tb(writer, &b, osPriorityNormal, DEFAULT_STACK_SIZE * 2);
+    while (!a.done || !b.done) {
+        Thread::wait(10);
+    }
+
+    bool result = check(&a);
+    result = check(&b) && result;
+    result = check_direct("/sd/direct.bin") && result;
+    notify_completion(result);
+}
@@ -0,0 +1,59 @@
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define STACK_SIZE          1024
+#define SIGNAL_DEPTH        0x01
+
+volatile int depth;
+
+// Uses at least size bytes of stack
+static void __attribute__((noinline)) use_stack(int size) {
+    volatile uint8_t area[512];
+    for (int i = 0; i < size && i < (int)sizeof(area); i++) {
+        area[i] = i;
+    }
+}
+
+void stack_thread(void const *argument) {
+    while (true) {
+        Thread::signal_wait(SIGNAL_DEPTH);
+        use_stack(depth);
+    }
+}
+
+int main (void) {
+    Thread thread(stack_thread, NULL, osPriorityNormal, STACK_SIZE);
+    bool result = true;
+
+    Thread::wait(10);
+    uint32_t idle_max = thread.max_stack();
+    printf("size %lu, used %lu, max %lu before\r\n", (unsigned long)thread.stack_size(),
+           (unsigned long)thread.used_stack(), (unsigned long)idle_max);
+    if ((thread.stack_size() != STACK_SIZE) || (idle_max == 0) || (idle_max >= 512)) {
+        result = false;
+    }
+
+    depth = 512;
+    thread.signal_set(SIGNAL_DEPTH);
+    Thread::wait(10);
+    uint32_t max = thread.max_stack();
+    printf("size %lu, used %lu, max %lu after\r\n", (unsigned long)thread.stack_size(),
+           (unsigned long)thread.used_stack(), (unsigned long)max);
+    // use_stack() runs from the base the idle peak was measured from, which
+    // already holds the exception frames of the wait
+    if ((max < 512) || (max <= idle_max) || (max > STACK_SIZE) ||
+        (thread.used_stack() > idle_max)) {
+        result = false;
+    }
+
+    rtos_stack_info_t isr;
+    rtos_stack_get_isr(&isr);
+    if ((isr.max == 0) || (isr.max > isr.size)) {
+        result = false;
+    }
+
+    rtos_stack_report();
+    notify_completion(result);
+    return 0;
+}
@@ -0,0 +1,96 @@
+/* Concurrent timeouts
+ *
+ * TIMERS one-shot RtosTimers are all pending at once, expiring SPACING_MS
+ * apart, while WAITERS threads keep timing out on a semaphore nobody
+ * releases. Every timer must fire once, in order and on time, and every
+ * semaphore wait must last for its timeout.
+ */
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define TIMERS          200
+#define FIRST_MS        20
+#define SPACING_MS      5
+#define WAITERS         4
+#define WAITS           20
+#define STACK_SIZE      512
+#define TOLERANCE_MS    2
+
+static Timer timer;
+static volatile int fired[TIMERS];
+static volatile int fired_at[TIMERS];
+static volatile int fired_count;
+
+static void expire(void const *argument) {
+    int i = (int)argument;
+    fired[i]++;
+    fired_at[i] = timer.read_ms();
+    fired_count++;
+}
+
+static Semaphore never(0);
+static volatile int wait_errors;
+static volatile int waits_done;
+
+static void waiter(void const *argument) {
+    int timeout = (int)argument;
+    Timer elapsed;
+    for (int i = 0; i < WAITS; i++) {
+        elapsed.reset();
+        elapsed.start();
+        int32_t tokens = never.wait(timeout + i);
+        elapsed.stop();
+        // a wait of n ticks lasts n-1 to n tick periods, read_ms() truncates
+        if ((tokens != 0) || (elapsed.read_ms() < timeout + i - 1)
+                || (elapsed.read_ms() > timeout + i + TOLERANCE_MS)) {
+            wait_errors++;
+        }
+    }
+    waits_done++;
+}
+
+static RtosTimer *timers[TIMERS];
+
+int main (void) {
+    bool result = true;
+
+    for (int i = 0; i < TIMERS; i++) {
+        timers[i] = new RtosTimer(expire, osTimerOnce, (void *)i);
+    }
+
+    Thread *waiters[WAITERS];
+    for (int i = 0; i < WAITERS; i++) {
+        waiters[i] = new Thread(waiter, (void *)(7 + 11 * i), osPriorityNormal, STACK_SIZE);
+    }
+
+    timer.start();
+    // Started in reverse order, the timers expire in creation order
+    for (int i = TIMERS - 1; i >= 0; i--) {
+        timers[i]->start(FIRST_MS + SPACING_MS * i);
+    }
+
+    Thread::wait(FIRST_MS + SPACING_MS * TIMERS + 100);
+
+    int late = 0;
+    for (int i = 0; i < TIMERS; i++) {
+        int expected = FIRST_MS + SPACING_MS * i;
+        if ((fired[i] != 1) || (fired_at[i] < expected - 1) || (fired_at[i] > expected + TOLERANCE_MS)) {
+            late++;
+        }
+    }
+    printf("%d timers fired, %d off time, %d/%d waiters done, %d wait errors\r\n",
+           fired_count, late, waits_done, WAITERS, wait_errors);
+    if ((fired_count != TIMERS) || (late != 0) || (waits_done != WAITERS) || (wait_errors != 0)) {
+        result = false;
+    }
+
+    for (int i = 0; i < WAITERS; i++) {
+        delete waiters[i];
+    }
+    for (int i = 0; i < TIMERS; i++) {
+        delete timers[i];
+    }
+    notify_completion(result);
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "mbed.h"
+#include "test_env.h"
+#include "rtos.h"
+
+#define QUEUE_SIZE      8
+#define DELAY_MS        50
+#define SLEEP_MS        50
+
+typedef WorkQueue<QUEUE_SIZE> SingleQueue;
+typedef WorkQueue<QUEUE_SIZE, 2> PairQueue;
+
+SingleQueue *isr_queue;
+Semaphore gate(0);
+Semaphore done(0);
+
+char order[QUEUE_SIZE + 1];
+volatile int order_len;
+volatile uint32_t run_at;
+
+void gate_job(void const *argument) {
+    gate.wait();
+}
+
+void log_job(void const *argument) {
+    order[order_len++] = (char)(int)argument;
+}
+
+void time_job(void const *argument) {
+    run_at = us_ticker_read();
+    done.release();
+}
+
+void sleep_job(void const *argument) {
+    Thread::wait(SLEEP_MS);
+    done.release();
+}
+
+void isr_post(void) {
+    isr_queue->post(log_job, (void *)'i');
+}
+
+int main (void) {
+    bool result = true;
+    work_queue_stats_t stats;
+    Timeout timeout;
+    SingleQueue single;
+    PairQueue pair;
+
+    // Priority order, cancellation and a full queue while the worker is held
+    single.post(gate_job, NULL, osPriorityRealtime);
+    Thread::wait(10);
+    single.post(log_job, (void *)'l', osPriorityLow);
+    single.post(log_job, (void *)'n', osPriorityNormal);
+    uint32_t id = single.post(log_job, (void *)'x', osPriorityNormal);
+    single.post(log_job, (void *)'h', osPriorityHigh);
+    if ((single.cancel(id) != osOK) || (single.cancel(id) != osErrorResource)) {
+        result = false;
+    }
+    // The gate job and the cancelled one still hold their blocks
+    for (int i = 5; i < QUEUE_SIZE; i++) {
+        single.post(log_job, (void *)'f', osPriorityIdle);
+    }
+    if (single.post(log_job, (void *)'e') != 0) {
+        result = false;
+    }
+    gate.release();
+    Thread::wait(10);
+    order[order_len] = '\0';
+    printf("order %s\r\n", order);
+    if (strcmp(order, "hnlfff") != 0) {
+        result = false;
+    }
+
+    // Posting from an interrupt handler
+    order_len = 0;
+    isr_queue = &single;
+    timeout.attach_us(isr_post, 5000);
+    Thread::wait(20);
+    if ((order_len != 1) || (order[0] != 'i')) {
+        result = false;
+    }
+
+    // Delayed job, and a cancelled one that never runs
+    order_len = 0;
+    id = single.post_delayed(DELAY_MS / 2, log_job, (void *)'c');
+    uint32_t start = us_ticker_read();
+    single.post_delayed(DELAY_MS, time_job);
+    if ((single.cancel(id) != osOK) || (done.wait(DELAY_MS * 2) <= 0)) {
+        result = false;
+    }
+    uint32_t delay = run_at - start;
+    printf("delayed by %lu us\r\n", (unsigned long)delay);
+    if ((delay < DELAY_MS * 1000 - 1000) || (delay > DELAY_MS * 1000 + 10000) || (order_len != 0)) {
+        result = false;
+    }
+
+    single.get_stats(&stats);
+    printf("posted %lu, rejected %lu, cancelled %lu, completed %lu, max wait %lu us\r\n",
+           (unsigned long)stats.posted, (unsigned long)stats.rejected,
+           (unsigned long)stats.cancelled, (unsigned long)stats.completed,
+           (unsigned long)stats.max_wait);
+    if ((stats.posted != 11) || (stats.rejected != 1) || (stats.cancelled != 2) ||
+        (stats.completed != 9) || (stats.pending != 0) || (stats.max_pending != 6) ||
+        (stats.max_wait == 0)) {
+        result = false;
+    }
+
+    // Two workers run two jobs side by side
+    start = us_ticker_read();
+    pair.post(sleep_job);
+    pair.post(sleep_job);
+    done.wait();
+    done.wait();
+    uint32_t elapsed = us_ticker_read() - start;
+    printf("two jobs in %lu us\r\n", (unsigned long)elapsed);
+    if (elapsed > SLEEP_MS * 1000 * 3 / 2) {
+        result = false;
+    }
+
+    notify_completion(result);
+    return 0;
+}
@@ -4,3 +4,6 @@ sudo add-apt-repository -y ppa:terry.guo/gcc-arm-embedded
 echo "Installing gcc_arm software"
 sudo apt-get update
 sudo apt-get install -y gcc-arm-none-eabi
+
+echo "Installing 32 bit host libraries for the HOST target"
+sudo apt-get install -y gcc-multilib g++-multilib
@@ -50,6 +50,8 @@ build_list = (
     { "target": "LPC4088",       "toolchains": "GCC_ARM", "libs": ["dsp", "rtos", "usb", "fat"] },
     { "target": "ARCH_PRO",      "toolchains": "GCC_ARM", "libs": ["dsp", "rtos", "fat"] },
     { "target": "LPC1549",       "toolchains": "GCC_ARM", "libs": ["dsp", "rtos", "fat"] },
+
+    { "target": "HOST",          "toolchains": "GCC_NATIVE", "libs": ["fat"] },
 )
 
 ################################################################################
@@ -0,0 +1,93 @@
+"""
+mbed SDK
+Copyright (c) 2011-2013 ARM Limited
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Renders the dump written by rtos_trace_dump() on the target as a thread
+switch timeline. The dump is read from a binary file, or from a text file
+holding it as hexadecimal digits.
+
+    python rtos_trace.py dump.bin
+"""
+import sys
+import struct
+from optparse import OptionParser
+
+STATES = ["terminated", "ready", "running", "delay", "interval", "event or",
+          "event and", "semaphore", "mailbox", "mutex", "event flags"]
+
+
+def load(path):
+    data = open(path, "rb").read()
+    text = data.decode("latin-1")
+    digits = "".join(text.split())
+    if digits and all(c in "0123456789abcdefABCDEF" for c in digits):
+        data = bytearray.fromhex(digits)
+    return bytes(data)
+
+
+def parse(data):
+    magic, version, n_threads, n_events, clock, now = struct.unpack_from("<4sBBHII", data, 0)
+    if magic != b"RTXT" or version != 1:
+        raise ValueError("not an RTX trace dump")
+    offset = 16
+    threads = []
+    for _ in range(n_threads):
+        entry, task_id, state, prio, _, cpu = struct.unpack_from("<IBBbBQ", data, offset)
+        threads.append({"entry": entry, "id": task_id, "state": state, "prio": prio, "cpu": cpu})
+        offset += 16
+    events = []
+    for _ in range(n_events):
+        events.append(struct.unpack_from("<IBBBB", data, offset)[:4])
+        offset += 8
+    return clock, now, threads, events
+
+
+def state_name(state):
+    return STATES[state] if state < len(STATES) else "state %d" % state
+
+
+def render(clock, now, threads, events):
+    names = {0: "-"}
+    for t in threads:
+        names[t["id"]] = "idle" if t["id"] == 255 else "%d:0x%08x" % (t["id"], t["entry"])
+
+    total = sum(t["cpu"] for t in threads) or 1
+    print("%-16s %5s %10s %14s %6s" % ("thread", "prio", "state", "cpu [us]", "%"))
+    for t in sorted(threads, key=lambda t: -t["cpu"]):
+        print("%-16s %5d %10s %14d %6.1f" % (names[t["id"]], t["prio"], state_name(t["state"]),
+                                             t["cpu"], 100.0 * t["cpu"] / total))
+
+    if not events:
+        return
+    # Time stamps wrap at 32 bits, take them relative to the dump time
+    us = lambda stamp: -((now - stamp) & 0xFFFFFFFF) * 1000000.0 / clock
+    print("")
+    print("%12s %12s  %-16s    %-16s %s" % ("time [us]", "ran [us]", "from", "to", "from left"))
+    last = None
+    for stamp, src, dst, state in events:
+        t = us(stamp)
+        ran = "" if last is None else "%12.1f" % (t - last)
+        print("%12.1f %12s  %-16s -> %-16s %s" % (t, ran, names.get(src, "%d" % src),
+                                                  names.get(dst, "%d" % dst), state_name(state)))
+        last = t
+
+
+if __name__ == '__main__':
+    parser = OptionParser(usage="%prog dump")
+    (options, args) = parser.parse_args()
+    if len(args) != 1:
+        parser.print_help()
+        sys.exit(1)
+    render(*parse(load(args[0])))
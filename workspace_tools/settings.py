@@ -55,6 +55,9 @@ MY_ARM_CLIB = join(ARM_PATH, "lib", "microlib")
 # GCC ARM
 GCC_ARM_PATH = ""
 
+# Host GCC, used for the HOST target
+GCC_NATIVE_PATH = ""
+
 # GCC CodeSourcery
 GCC_CS_PATH = "C:/Program Files (x86)/CodeSourcery/Sourcery_CodeBench_Lite_for_ARM_EABI/bin"
 
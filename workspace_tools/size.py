@@ -53,6 +53,7 @@ BENCHMARKS = [
     ("BENCHMARK_3", "FP"),
     ("BENCHMARK_4", "MBED"),
     ("BENCHMARK_5", "ALL"),
+    ("BENCHMARK_10", "COMPACT_PRINTF"),
 ]
 BENCHMARK_DATA_PATH = join(TOOLS_DATA, 'benchmarks.csv')
 
@@ -21,7 +21,8 @@ CORE_LABELS = {
     "Cortex-M0+": "M0P",
     "Cortex-M3" : "M3",
     "Cortex-M4" : "M4",
-    "Cortex-M4F" : "M4"
+    "Cortex-M4F" : "M4",
+    "POSIX"     : "POSIX"
 }
 
 import os
@@ -608,6 +609,17 @@ class MTS_GAMBIT(Target):
         self.is_disk_virtual = True
         self.default_toolchain = "ARM"
 
+# The mbed HAL on a POSIX host, the SDK builds as a native executable
+class HOST(Target):
+    def __init__(self):
+        Target.__init__(self)
+        self.core = "POSIX"
+        self.supported_toolchains = ["GCC_NATIVE"]
+        self.default_toolchain = "GCC_NATIVE"
+
+    def program_cycle_s(self):
+        return 0
+
 # Get a single instance for each target
 TARGETS = [
     LPC2368(),
@@ -657,6 +669,7 @@ TARGETS = [
     RBLAB_NRF51822(),
     GHI_MBUINO(),
     MTS_GAMBIT(),
+    HOST(),
 ]
 
 # Map each target name to its unique instance
@@ -286,6 +286,41 @@ TESTS = [
         "source_dir": join(BENCHMARKS_DIR, "all"),
         "dependencies": [MBED_LIBRARIES]
     },
+    {
+        "id": "BENCHMARK_6", "description": "Callback call overhead",
+        "source_dir": join(BENCHMARKS_DIR, "callback"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_7", "description": "FastIO toggle rate",
+        "source_dir": join(BENCHMARKS_DIR, "fastio"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_8", "description": "Interrupt latency through InterruptManager",
+        "source_dir": join(BENCHMARKS_DIR, "irq_latency"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_9", "description": "Profiling statistics",
+        "source_dir": join(BENCHMARKS_DIR, "profile"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_10", "description": "Size (compact printf)",
+        "source_dir": join(BENCHMARKS_DIR, "printf_compact"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_11", "description": "Compact printf against the C library",
+        "source_dir": join(BENCHMARKS_DIR, "printf_speed"),
+        "dependencies": [MBED_LIBRARIES]
+    },
+    {
+        "id": "BENCHMARK_12", "description": "TLSF heap against the C library",
+        "source_dir": join(BENCHMARKS_DIR, "heap_stress"),
+        "dependencies": [MBED_LIBRARIES]
+    },
 
     # Not automated MBED tests
     {
@@ -483,6 +518,64 @@ TESTS = [
         "source_dir": join(TEST_DIR, "mbed", "pin_toggling"),
         "dependencies": [MBED_LIBRARIES],
     },
+    {
+        "id": "MBED_33", "description": "EventQueue deferred callbacks",
+        "source_dir": join(TEST_DIR, "mbed", "event_queue"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "duration": 15,
+    },
+    {
+        "id": "MBED_34", "description": "SPI asynchronous transfers (MOSI wired to MISO)",
+        "source_dir": join(TEST_DIR, "mbed", "spi_transfer"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+    },
+    {
+        "id": "MBED_35", "description": "I2C queued transactions (TMP102)",
+        "source_dir": join(TEST_DIR, "mbed", "i2c_transfer"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "peripherals": ["TMP102"]
+    },
+    {
+        "id": "MBED_36", "description": "BufferedSerial Echo at 115200",
+        "source_dir": join(TEST_DIR, "mbed", "echo_buffered"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "host_test": "echo"
+    },
+    {
+        "id": "MBED_37", "description": "AnalogIn streaming at 50kHz",
+        "source_dir": join(TEST_DIR, "mbed", "analog_stream"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "K64F"],
+    },
+    {
+        "id": "MBED_38", "description": "Critical sections and interrupt masking budget",
+        "source_dir": join(TEST_DIR, "mbed", "critical_section"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+    },
+    {
+        "id": "MBED_39", "description": "Ticker overrun policies and jitter",
+        "source_dir": join(TEST_DIR, "mbed", "ticker_overrun"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+    },
+    {
+        "id": "MBED_40", "description": "Low power ticker wake up from deepsleep",
+        "source_dir": join(TEST_DIR, "mbed", "lp_ticker"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["KL25Z", "HOST"],
+    },
+    {
+        "id": "MBED_41", "description": "Sleep with interrupts masked",
+        "source_dir": join(TEST_DIR, "mbed", "wfi_masked"),
+        "dependencies": [MBED_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["HOST", "LPC1768", "K64F"],
+    },
 
     # CMSIS RTOS tests
     {
@@ -601,6 +694,56 @@ TESTS = [
         "peripherals": ["SD"],
         "mcu": ["LPC1768", "LPC11U24", "LPC812", "KL25Z", "KL05Z", "K64F", "KL46Z"],
     },
+    {
+        "id": "RTOS_10", "description": "SD File access from two threads",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "file_threads"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB, FS_LIBRARY],
+        "automated": True,
+        "peripherals": ["SD"],
+        "mcu": ["LPC1768", "K64F"],
+    },
+    {
+        "id": "RTOS_11", "description": "Thread stack usage",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "stack"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC1549", "LPC11U24", "LPC812", "KL25Z", "KL05Z", "K64F", "KL46Z"],
+    },
+    {
+        "id": "RTOS_12", "description": "Context switch latency",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "context_switch"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC1549", "K64F", "KL46Z"],
+    },
+    {
+        "id": "RTOS_13", "description": "Concurrent timeouts",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "timeouts"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC4088", "K64F"],
+    },
+    {
+        "id": "RTOS_14", "description": "Thread CPU time and switch trace",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "cpu_time"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC4088", "K64F"],
+    },
+    {
+        "id": "RTOS_15", "description": "Event flags",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "event_flags"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC4088", "K64F"],
+    },
+    {
+        "id": "RTOS_16", "description": "Work queue",
+        "source_dir": join(TEST_DIR, "rtos", "mbed", "work_queue"),
+        "dependencies": [MBED_LIBRARIES, RTOS_LIBRARIES, TEST_MBED_LIB],
+        "automated": True,
+        "mcu": ["LPC1768", "LPC4088", "K64F"],
+    },
 
     # Networking Tests
     {
@@ -188,7 +188,7 @@ LEGACY_IGNORE_DIRS = set([
 LEGACY_TOOLCHAIN_NAMES = {
     'ARM_STD':'ARM', 'ARM_MICRO': 'uARM',
     'GCC_ARM': 'GCC_ARM', 'GCC_CR': 'GCC_CR', 'GCC_CS': 'GCC_CS',
-    'IAR': 'IAR',
+    'IAR': 'IAR', 'GCC_NATIVE': 'GCC_NATIVE',
 }
 
 
@@ -692,14 +692,14 @@ class mbedToolchain:
 
 
 from workspace_tools.toolchains.arm import ARM_STD, ARM_MICRO
-from workspace_tools.toolchains.gcc import GCC_ARM, GCC_CS, GCC_CR, GCC_CW_EWL, GCC_CW_NEWLIB
+from workspace_tools.toolchains.gcc import GCC_ARM, GCC_CS, GCC_CR, GCC_CW_EWL, GCC_CW_NEWLIB, GCC_NATIVE
 from workspace_tools.toolchains.iar import IAR
 
 TOOLCHAIN_CLASSES = {
     'ARM': ARM_STD, 'uARM': ARM_MICRO,
     'GCC_ARM': GCC_ARM, 'GCC_CS': GCC_CS, 'GCC_CR': GCC_CR,
     'GCC_CW_EWL': GCC_CW_EWL, 'GCC_CW_NEWLIB': GCC_CW_NEWLIB,
-    'IAR': IAR
+    'IAR': IAR, 'GCC_NATIVE': GCC_NATIVE
 }
 
 TOOLCHAINS = set(TOOLCHAIN_CLASSES.keys())
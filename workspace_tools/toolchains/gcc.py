@@ -15,10 +15,12 @@ See the License for the specific language governing permissions and
 limitations under the License.
 """
 import re
+from os import chmod
 from os.path import join, basename, splitext
+from shutil import copyfile
 
 from workspace_tools.toolchains import mbedToolchain
-from workspace_tools.settings import GCC_ARM_PATH, GCC_CR_PATH, GCC_CS_PATH, CW_EWL_PATH, CW_GCC_PATH
+from workspace_tools.settings import GCC_ARM_PATH, GCC_CR_PATH, GCC_CS_PATH, CW_EWL_PATH, CW_GCC_PATH, GCC_NATIVE_PATH
 from workspace_tools.settings import GOANNA_PATH
 from workspace_tools.hooks import hook_tool
 
@@ -30,7 +32,7 @@ class GCC(mbedToolchain):
     CIRCULAR_DEPENDENCIES = True
     DIAGNOSTIC_PATTERN = re.compile('((?P<line>\d+):)(\d+:)? (?P<severity>warning|error): (?P<message>.+)')
 
-    def __init__(self, target, options=None, notify=None, macros=None, tool_path=""):
+    def __init__(self, target, options=None, notify=None, macros=None, tool_path="", tool_prefix="arm-none-eabi-"):
         mbedToolchain.__init__(self, target, options, notify, macros)
 
         if target.core == "Cortex-M0+":
@@ -40,7 +42,11 @@ class GCC(mbedToolchain):
         else:
             cpu = target.core.lower()
 
-        self.cpu = ["-mcpu=%s" % cpu]
+        if target.core == "POSIX":
+            # The SDK stores pointers in uint32_t, so the host build is 32 bit
+            self.cpu = ["-m32", "-pthread"]
+        else:
+            self.cpu = ["-mcpu=%s" % cpu]
         if target.core.startswith("Cortex"):
             self.cpu.append("-mthumb")
 
@@ -66,8 +72,8 @@ class GCC(mbedToolchain):
         else:
             common_flags.append("-O2")
 
-        main_cc = join(tool_path, "arm-none-eabi-gcc")
-        main_cppc = join(tool_path, "arm-none-eabi-g++")
+        main_cc = join(tool_path, tool_prefix + "gcc")
+        main_cppc = join(tool_path, tool_prefix + "g++")
         self.asm = [main_cc, "-x", "assembler-with-cpp"] + common_flags
         if not "analyze" in self.options:
             self.cc  = [main_cc, "-std=gnu99"] + common_flags
@@ -76,11 +82,11 @@ class GCC(mbedToolchain):
             self.cc  = [join(GOANNA_PATH, "goannacc"), "--with-cc=" + main_cc.replace('\\', '/'), "-std=gnu99", "--dialect=gnu", '--output-format="%s"' % self.GOANNA_FORMAT] + common_flags
             self.cppc= [join(GOANNA_PATH, "goannac++"), "--with-cxx=" + main_cppc.replace('\\', '/'), "-std=gnu++98", "-fno-rtti", "--dialect=gnu", '--output-format="%s"' % self.GOANNA_FORMAT] + common_flags
 
-        self.ld = [join(tool_path, "arm-none-eabi-gcc"), "-Wl,--gc-sections", "-Wl,--wrap,main"] + self.cpu
+        self.ld = [join(tool_path, tool_prefix + "gcc"), "-Wl,--gc-sections", "-Wl,--wrap,main"] + self.cpu
         self.sys_libs = ["stdc++", "supc++", "m", "c", "gcc"]
 
-        self.ar = join(tool_path, "arm-none-eabi-ar")
-        self.elf2bin = join(tool_path, "arm-none-eabi-objcopy")
+        self.ar = join(tool_path, tool_prefix + "ar")
+        self.elf2bin = join(tool_path, tool_prefix + "objcopy")
 
     def assemble(self, source, object, includes):
         return [self.hook.get_cmdline_assembler(self.asm + ['-D%s' % s for s in self.get_symbols() + self.macros] + ["-I%s" % i for i in includes] + ["-o", object, source])]
@@ -161,7 +167,10 @@ class GCC(mbedToolchain):
         if self.CIRCULAR_DEPENDENCIES:
             libs.extend(libs)
 
-        self.default_cmd(self.hook.get_cmdline_linker(self.ld + ["-T%s" % mem_map, "-o", output] +
+        # without a linker script the toolchain default is used
+        script = ["-T%s" % mem_map] if mem_map is not None else []
+
+        self.default_cmd(self.hook.get_cmdline_linker(self.ld + script + ["-o", output] +
             objects + ["-L%s" % L for L in lib_dirs] + libs))
 
     @hook_tool
@@ -181,6 +190,22 @@ class GCC_ARM(GCC):
         self.sys_libs.append("nosys")
 
 
+class GCC_NATIVE(GCC):
+    """ The host compiler, building the SDK for TARGET_HOST as a Linux executable """
+    def __init__(self, target, options=None, notify=None, macros=None):
+        GCC.__init__(self, target, options, notify, macros, GCC_NATIVE_PATH, "")
+
+        # retarget.cpp routes the names of mbed FileBases to the SDK
+        self.ld.extend(["-Wl,--wrap,fopen", "-Wl,--wrap,remove", "-Wl,--wrap,rename"])
+        self.sys_libs = ["stdc++", "m", "pthread", "rt"]
+
+    @hook_tool
+    def binary(self, resources, elf, bin):
+        # the executable is the binary
+        copyfile(elf, bin)
+        chmod(bin, 0755)
+
+
 class GCC_CR(GCC):
     def __init__(self, target, options=None, notify=None, macros=None):
         GCC.__init__(self, target, options, notify, macros, GCC_CR_PATH)